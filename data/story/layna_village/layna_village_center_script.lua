@@ -336,60 +336,8 @@ function _CreateEvents()
 
     vt_map.ScriptedSpriteEvent.Create("Quest1: Make Orlinn run event end", orlinn, "orlinn_run_event_end", "");
 
-    -- Kalya calls for Orlinn
-    event = vt_map.ScriptedEvent.Create("Kalya brings back Orlinn event start", "kalya_brings_orlinn_back_start", "");
-    event:AddEventLinkAtEnd("Kalya tells Bronann to follow her");
-
-    dialogue = vt_map.SpriteDialogue.Create();
-    text = vt_system.Translate("As you wish. Follow me.");
-    dialogue:AddLine(text, kalya);
-    event = vt_map.DialogueEvent.Create("Kalya tells Bronann to follow her", dialogue);
-    event:AddEventLinkAtEnd("Kalya goes at the center of village");
-    event:AddEventLinkAtEnd("Bronann follows Kalya at the center of the village", 1000);
-
-    event = vt_map.PathMoveSpriteEvent.Create("Kalya goes at the center of village", kalya, 52, 47, true);
-    event:AddEventLinkAtEnd("Kalya looks south");
-    event:AddEventLinkAtEnd("Kalya tells Orlinn to come");
-
-    event = vt_map.PathMoveSpriteEvent.Create("Bronann follows Kalya at the center of the village", bronann, 48, 47, true);
-    event:AddEventLinkAtEnd("Bronann looks south");
-
-    dialogue = vt_map.SpriteDialogue.Create();
-    text = vt_system.Translate("ORLINN! Come here, NOW!");
-    dialogue:AddLine(text, kalya);
-    event = vt_map.DialogueEvent.Create("Kalya tells Orlinn to come", dialogue);
-    event:AddEventLinkAtEnd("Orlinn comes near Kalya");
-
-    event = vt_map.PathMoveSpriteEvent.Create("Orlinn comes near Kalya", orlinn, 52, 50, true);
-    event:AddEventLinkAtEnd("Orlinn looks at Kalya");
-    event:AddEventLinkAtEnd("Kalya tells Orlinn to give the pen");
-
-    dialogue = vt_map.SpriteDialogue.Create();
-    text = vt_system.Translate("Orlinn, give back the pen to Bronann or I shall sma...");
-    dialogue:AddLineEmote(text, kalya, "exclamation");
-    text = vt_system.Translate("Yea, yes, here it is.");
-    dialogue:AddLineEmote(text, orlinn, "exclamation");
-    event = vt_map.DialogueEvent.Create("Kalya tells Orlinn to give the pen", dialogue);
-    event:AddEventLinkAtEnd("Orlinn comes near Bronann");
-
-    event = vt_map.PathMoveSpriteEvent.Create("Orlinn comes near Bronann", orlinn, 48, 50, false);
-    event:AddEventLinkAtEnd("Orlinn looks at Bronann");
-    event:AddEventLinkAtEnd("Kalya looks at Orlinn");
-    event:AddEventLinkAtEnd("Orlinn gives the pen to Bronann");
-
-    event = vt_map.TreasureEvent.Create("Orlinn gives the pen to Bronann");
-    event:AddItem(70001, 1); -- The ink key item
-    event:AddEventLinkAtEnd("Orlinn apologizes");
-
-    dialogue = vt_map.SpriteDialogue.Create();
-    text = vt_system.Translate("I found that pen under a tree near the river. I just wanted to play.");
-    dialogue:AddLineEmote(text, orlinn, "sweat drop");
-    text = vt_system.Translate("Don't worry about it.");
-    dialogue:AddLine(text, bronann);
-    event = vt_map.DialogueEvent.Create("Orlinn apologizes", dialogue);
-    event:AddEventLinkAtEnd("Orlinn comes back event end");
-
-    vt_map.ScriptedEvent.Create("Orlinn comes back event end", "orlinn_comes_back_event_end", "");
+    -- Kalya calls for Orlinn: The event chain is only created when first started.
+    EventManager:DeclareEvent("Kalya brings back Orlinn event start", "create_kalya_brings_orlinn_back_events");
 
     -- Georges event
     vt_map.ScriptedEvent.Create("Quest1: Georges tells whom the barley meal was for", "Quest1GeorgesTellsBronannAboutLilly", "");
@@ -695,15 +643,66 @@ function _CreateEvents()
     _UpdateOliviaDialogue();
 end
 
--- zones
-local bronanns_home_entrance_zone = nil
-local to_riverbank_zone = nil
-local to_village_entrance_zone = nil
-local to_kalya_house_path_zone = nil
-local shop_entrance_zone = nil
-local secret_path_zone = nil
-local to_layna_forest_zone = nil
-local sophia_house_entrance_zone = nil
+-- Creates the event chain where Kalya makes Orlinn give the pen back to Bronann.
+function _CreateKalyaBringsBackOrlinnEvents()
+    local event = nil
+    local text = nil
+
+    local follow_dialogue = vt_map.SpriteDialogue.Create();
+    text = vt_system.Translate("As you wish. Follow me.");
+    follow_dialogue:AddLine(text, kalya);
+
+    local come_dialogue = vt_map.SpriteDialogue.Create();
+    text = vt_system.Translate("ORLINN! Come here, NOW!");
+    come_dialogue:AddLine(text, kalya);
+
+    local pen_dialogue = vt_map.SpriteDialogue.Create();
+    text = vt_system.Translate("Orlinn, give back the pen to Bronann or I shall sma...");
+    pen_dialogue:AddLineEmote(text, kalya, "exclamation");
+    text = vt_system.Translate("Yea, yes, here it is.");
+    pen_dialogue:AddLineEmote(text, orlinn, "exclamation");
+
+    local apologize_dialogue = vt_map.SpriteDialogue.Create();
+    text = vt_system.Translate("I found that pen under a tree near the river. I just wanted to play.");
+    apologize_dialogue:AddLineEmote(text, orlinn, "sweat drop");
+    text = vt_system.Translate("Don't worry about it.");
+    apologize_dialogue:AddLine(text, bronann);
+
+    event = vt_map.TreasureEvent.Create("Orlinn gives the pen to Bronann");
+    event:AddItem(70001, 1); -- The ink key item
+    event:AddEventLinkAtEnd("Orlinn apologizes");
+
+    EventManager:LoadEventGraph({
+        nodes = {
+            { id = "Kalya brings back Orlinn event start", type = "scripted", start = "kalya_brings_orlinn_back_start" },
+            { id = "Kalya tells Bronann to follow her", type = "dialogue", dialogue = follow_dialogue },
+            { id = "Kalya goes at the center of village", type = "path_move", sprite = kalya, x = 52, y = 47, run = true },
+            { id = "Bronann follows Kalya at the center of the village", type = "path_move", sprite = bronann, x = 48, y = 47, run = true },
+            { id = "Kalya tells Orlinn to come", type = "dialogue", dialogue = come_dialogue },
+            { id = "Orlinn comes near Kalya", type = "path_move", sprite = orlinn, x = 52, y = 50, run = true },
+            { id = "Kalya tells Orlinn to give the pen", type = "dialogue", dialogue = pen_dialogue },
+            { id = "Orlinn comes near Bronann", type = "path_move", sprite = orlinn, x = 48, y = 50, run = false },
+            { id = "Orlinn apologizes", type = "dialogue", dialogue = apologize_dialogue },
+            { id = "Orlinn comes back event end", type = "scripted", start = "orlinn_comes_back_event_end" },
+        },
+        links = {
+            { from = "Kalya brings back Orlinn event start", to = "Kalya tells Bronann to follow her" },
+            { from = "Kalya tells Bronann to follow her", to = "Kalya goes at the center of village" },
+            { from = "Kalya tells Bronann to follow her", to = "Bronann follows Kalya at the center of the village", delay = 1000 },
+            { from = "Kalya goes at the center of village", to = "Kalya looks south" },
+            { from = "Kalya goes at the center of village", to = "Kalya tells Orlinn to come" },
+            { from = "Bronann follows Kalya at the center of the village", to = "Bronann looks south" },
+            { from = "Kalya tells Orlinn to come", to = "Orlinn comes near Kalya" },
+            { from = "Orlinn comes near Kalya", to = "Orlinn looks at Kalya" },
+            { from = "Orlinn comes near Kalya", to = "Kalya tells Orlinn to give the pen" },
+            { from = "Kalya tells Orlinn to give the pen", to = "Orlinn comes near Bronann" },
+            { from = "Orlinn comes near Bronann", to = "Orlinn looks at Bronann" },
+            { from = "Orlinn comes near Bronann", to = "Kalya looks at Orlinn" },
+            { from = "Orlinn comes near Bronann", to = "Orlinn gives the pen to Bronann" },
+            { from = "Orlinn apologizes", to = "Orlinn comes back event end" },
+        }
+    });
+end
 
 function _CreateZones()
     -- N.B.: left, right, top, bottom
@@ -1032,6 +1031,10 @@ map_functions = {
         _UpdateOrlinnAndKalyaState();
     end,
 
+    create_kalya_brings_orlinn_back_events = function()
+        _CreateKalyaBringsBackOrlinnEvents();
+    end,
+
     kalya_brings_orlinn_back_start = function()
         -- Use the scene state so that the character can't move by player's input
         Map:PushState(vt_map.MapMode.STATE_SCENE);
@@ -869,8 +869,7 @@ bool GameGlobal::AutoSave(const std::string& map_data_file, const std::string& m
                           uint32_t stamina,
                           uint32_t x_position, uint32_t y_position)
 {
-    std::ostringstream filename;
-    filename << GetUserDataPath() + "saved_game_" << GetGameSlotId() << "_autosave.lua";
+    std::string filename = GetSaveFilename(GetGameSlotId(), true);
 
     // Make the map location known globally to other code that may need to know this information
     std::string previous_map_data = _map_data_filename;
@@ -881,7 +880,7 @@ bool GameGlobal::AutoSave(const std::string& map_data_file, const std::string& m
     _map_script_filename = map_script_file;
     _save_stamina = stamina;
 
-    bool save_completed = SaveGame(filename.str(), GetGameSlotId(), x_position, y_position);
+    bool save_completed = SaveGame(filename, GetGameSlotId(), x_position, y_position);
 
     // Restore previous map data
     _map_data_filename = previous_map_data;
@@ -980,6 +979,9 @@ bool GameGlobal::SaveGame(const std::string &filename, uint32_t slot_id, uint32_
 
     file.CloseFile();
 
+    // The save files changed.
+    vt_utils::InvalidateSaveFileCatalog();
+
     // Store the game slot the game is coming from.
     _game_slot_id = slot_id;
 
@@ -467,6 +467,7 @@ void GlobalMedia::_LoadSoundFile(const std::string& sound_name, const std::strin
         return;
 
     _sounds[sound_name] = new vt_audio::SoundDescriptor();
+    _sounds[sound_name]->SetBus(vt_audio::AUDIO_BUS_UI);
     if(!_sounds[sound_name]->LoadAudio(filename))
         PRINT_WARNING << "Failed to load '" << filename << "' needed by shop mode" << std::endl;
 }
@@ -37,7 +37,8 @@ namespace vt_gui
 
 Option::Option() :
     disabled(false),
-    image(nullptr)
+    image(nullptr),
+    constructed_elements(0)
 {}
 
 
@@ -52,7 +53,9 @@ Option::~Option()
 Option::Option(const Option &copy) :
     disabled(copy.disabled),
     elements(copy.elements),
-    text(copy.text)
+    text(copy.text),
+    message_id(copy.message_id),
+    constructed_elements(copy.constructed_elements)
 {
     if(copy.image == nullptr) {
         image = nullptr;
@@ -73,6 +76,8 @@ Option &Option::operator=(const Option &copy)
     disabled = copy.disabled;
     elements = copy.elements;
     text = copy.text;
+    message_id = copy.message_id;
+    constructed_elements = copy.constructed_elements;
     if(copy.image == nullptr) {
         image = nullptr;
     } else {
@@ -89,6 +94,8 @@ void Option::Clear()
     disabled = false;
     elements.clear();
     text.clear();
+    message_id.clear();
+    constructed_elements = 0;
     if(image != nullptr) {
         delete image;
         image = nullptr;
@@ -112,6 +119,7 @@ OptionBox::OptionBox() :
     _vertical_wrap_mode(VIDEO_WRAP_MODE_NONE),
     _skip_disabled(false),
     _enable_switching(false),
+    _locale_generation(vt_system::SystemManager ? vt_system::SystemManager->GetLocaleGeneration() : 0),
     _draw_left_column(0),
     _draw_top_row(0),
     _cursor_xoffset(0.0f),
@@ -194,6 +202,9 @@ void OptionBox::Update(uint32_t frame_time)
 
 void OptionBox::Draw()
 {
+    // Only translate the options again when they are actually shown after a language change.
+    _UpdateTranslatedOptions();
+
     VideoManager->PushState();
     VideoManager->SetDrawFlags(_xalign, _yalign, VIDEO_BLEND, 0);
 
@@ -447,6 +458,20 @@ void OptionBox::AddOption(const vt_utils::ustring &text)
 
 
 
+void OptionBox::AddTranslatableOption(const std::string &message_id)
+{
+    Option option;
+    if(_ConstructOption(vt_system::UTranslate(message_id), option) == false) {
+        IF_PRINT_WARNING(VIDEO_DEBUG) << "argument contained an invalid formatted string: " << message_id << std::endl;
+        return;
+    }
+
+    option.message_id = message_id;
+    _options.push_back(option);
+}
+
+
+
 void OptionBox::AddOptionElementText(uint32_t option_index, const ustring &text)
 {
     if(option_index >= GetNumberOptions()) {
@@ -568,6 +593,20 @@ bool OptionBox::SetOptionText(uint32_t index, const vt_utils::ustring &text)
 
 
 
+bool OptionBox::SetTranslatableOptionText(uint32_t index, const std::string &message_id)
+{
+    if(index >= GetNumberOptions()) {
+        IF_PRINT_WARNING(VIDEO_DEBUG) << "argument was invalid (out of bounds): " << index << std::endl;
+        return false;
+    }
+
+    _ConstructOption(vt_system::UTranslate(message_id), _options[index]);
+    _options[index].message_id = message_id;
+    return true;
+}
+
+
+
 void OptionBox::SetSelection(uint32_t index)
 {
     if(index >= GetNumberOptions()) {
@@ -957,11 +996,52 @@ bool OptionBox::_ConstructOption(const ustring &format_string, Option &op)
         op.elements.push_back(new_element);
     } // while (tmp.empty() == false)
 
+    op.constructed_elements = op.elements.size();
     return true;
 } // bool _ConstructOption(const ustring& format_string, Option& option)
 
 
 
+void OptionBox::_UpdateTranslatedOptions()
+{
+    uint32_t locale_generation = vt_system::SystemManager->GetLocaleGeneration();
+    if(_locale_generation == locale_generation)
+        return;
+
+    _locale_generation = locale_generation;
+
+    for(uint32_t i = 0; i < _options.size(); ++i) {
+        Option &op = _options[i];
+        if(op.message_id.empty())
+            continue;
+
+        // Only the elements built from the text are rebuilt.
+        Option translated;
+        if(_ConstructOption(vt_system::UTranslate(op.message_id), translated) == false)
+            continue;
+        uint32_t constructed_elements = translated.elements.size();
+
+        // Keep the elements added afterwards, such as the AddOptionElementImage() images.
+        for(uint32_t j = op.constructed_elements; j < op.elements.size(); ++j) {
+            OptionElement element = op.elements[j];
+            if(element.type == VIDEO_OPTION_ELEMENT_TEXT) {
+                element.value = static_cast<int32_t>(translated.text.size());
+                translated.text.push_back(op.text[op.elements[j].value]);
+            }
+            translated.elements.push_back(element);
+        }
+        if(translated.image == nullptr)
+            std::swap(translated.image, op.image);
+
+        op.elements.swap(translated.elements);
+        op.text.swap(translated.text);
+        std::swap(op.image, translated.image);
+        op.constructed_elements = constructed_elements;
+    }
+}
+
+
+
 bool OptionBox::_ChangeSelection(int32_t offset, bool horizontal)
 {
     // Do nothing if the movement is horizontal and there is only one column with no horizontal wrap shifting
@@ -220,6 +220,13 @@ public:
 
     //! \brief Contains all images used for this option
     vt_video::StillImage *image;
+
+    //! \brief The message id the option text is translated from, or empty when the option isn't translatable
+    std::string message_id;
+
+    //! \brief The number of leading elements built from the option text.
+    //! The following ones were added afterwards, and are kept when the text is translated again.
+    uint32_t constructed_elements;
 }; // class Option
 
 } // namespace private_gui
@@ -333,6 +340,19 @@ public:
     **/
     void AddOptionElementPosition(uint32_t option_index, uint32_t position_length);
 
+    /** \brief Adds a new option whose text is translated from the given message id
+    *** \param message_id The untranslated formatting text for the new option
+    *** The option text is translated again on the next draw whenever the language changes.
+    **/
+    void AddTranslatableOption(const std::string &message_id);
+
+    /** \brief Changes the text of a particular option to a translatable message id
+    *** \param index The index of the option to change
+    *** \param message_id The untranslated formatting text to change the option to
+    *** \return False if the option text could not be changed
+    **/
+    bool SetTranslatableOptionText(uint32_t index, const std::string &message_id);
+
     /** \brief Changes the stored information of a particular option
     *** \param index The index of the option to change
     *** \param text The text to change the option to
@@ -544,6 +564,9 @@ private:
     //! \brief The text style that the options should be rendered in
     vt_video::TextStyle _text_style;
 
+    //! \brief The system locale generation the translatable options were last translated with
+    uint32_t _locale_generation;
+
     //! \brief The column of row of data that is drawn in the top-left cell
     uint32_t _draw_left_column, _draw_top_row;
 
@@ -647,6 +670,9 @@ private:
     **/
     void _DetermineScrollArrows();
 
+    //! \brief Translates again the translatable options if the language changed since they were last translated
+    void _UpdateTranslatedOptions();
+
     /** \brief Draws a single option cell
     *** \param op The option contents to draw within the cell
     *** \param bounds The boundary coordinates for the information cell
@@ -50,7 +50,23 @@ void OptionMenu::AddOption(const ustring &text, GameOptionsMenuHandler* handler,
                          void (GameOptionsMenuHandler::*left_function)(), void (GameOptionsMenuHandler::*right_function)())
 {
     OptionBox::AddOption(text);
+    _AddHandlers(handler, confirm_function, up_function, down_function, left_function, right_function);
+}
+
+void OptionMenu::AddTranslatableOption(const std::string &message_id, GameOptionsMenuHandler* handler,
+                                       void (GameOptionsMenuHandler::*confirm_function)(),
+                                       void (GameOptionsMenuHandler::*up_function)(), void (GameOptionsMenuHandler::*down_function)(),
+                                       void (GameOptionsMenuHandler::*left_function)(), void (GameOptionsMenuHandler::*right_function)())
+{
+    OptionBox::AddTranslatableOption(message_id);
+    _AddHandlers(handler, confirm_function, up_function, down_function, left_function, right_function);
+}
 
+void OptionMenu::_AddHandlers(GameOptionsMenuHandler* handler,
+                              void (GameOptionsMenuHandler::*confirm_function)(),
+                              void (GameOptionsMenuHandler::*up_function)(), void (GameOptionsMenuHandler::*down_function)(),
+                              void (GameOptionsMenuHandler::*left_function)(), void (GameOptionsMenuHandler::*right_function)())
+{
     _handler = handler;
 
     if (_handler == nullptr) {
@@ -130,7 +146,8 @@ void OptionMenu::InputRight()
     }
 }
 
-const uint16_t SKIN_MENU_INDEX = 5;
+const uint16_t SCALE_FILTER_MENU_INDEX = 5;
+const uint16_t SKIN_MENU_INDEX = 6;
 
 GameOptionsMenuHandler::GameOptionsMenuHandler(vt_mode_manager::GameMode* parent_mode):
     _first_run(false),
@@ -350,13 +367,9 @@ void GameOptionsMenuHandler::Draw()
 
 void GameOptionsMenuHandler::ReloadTranslatableMenus()
 {
-    _SetupOptionsMenu();
-    _SetupVideoOptionsMenu();
-    _SetupAudioOptionsMenu();
-    _SetupGameOptions();
-    _SetupKeySettingsMenu();
-    _SetupJoySettingsMenu();
-    _SetupResolutionMenu();
+    // Nothing is rebuilt here: The static options are translated again lazily
+    // when next drawn, and the menus displaying values are refreshed
+    // each time they are entered.
 
     // Make the parent game mode reload its translated text
     if (_parent_mode)
@@ -384,12 +397,12 @@ void GameOptionsMenuHandler::_SetupOptionsMenu()
     _options_menu.SetCursorOffset(-50.0f, -28.0f);
     _options_menu.SetSkipDisabled(true);
 
-    _options_menu.AddOption(UTranslate("Video"), this, &GameOptionsMenuHandler::_OnVideoOptions);
-    _options_menu.AddOption(UTranslate("Audio"), this, &GameOptionsMenuHandler::_OnAudioOptions);
-    _options_menu.AddOption(UTranslate("Game"), this, &GameOptionsMenuHandler::_OnGameOptions);
-    _options_menu.AddOption(UTranslate("Language"), this, &GameOptionsMenuHandler::_OnLanguageOptions);
-    _options_menu.AddOption(UTranslate("Key Settings"), this, &GameOptionsMenuHandler::_OnKeySettings);
-    _options_menu.AddOption(UTranslate("Joystick Settings"), this, &GameOptionsMenuHandler::_OnJoySettings);
+    _options_menu.AddTranslatableOption("Video", this, &GameOptionsMenuHandler::_OnVideoOptions);
+    _options_menu.AddTranslatableOption("Audio", this, &GameOptionsMenuHandler::_OnAudioOptions);
+    _options_menu.AddTranslatableOption("Game", this, &GameOptionsMenuHandler::_OnGameOptions);
+    _options_menu.AddTranslatableOption("Language", this, &GameOptionsMenuHandler::_OnLanguageOptions);
+    _options_menu.AddTranslatableOption("Key Settings", this, &GameOptionsMenuHandler::_OnKeySettings);
+    _options_menu.AddTranslatableOption("Joystick Settings", this, &GameOptionsMenuHandler::_OnJoySettings);
 
     _options_menu.SetSelection(0);
 
@@ -403,7 +416,7 @@ void GameOptionsMenuHandler::_SetupVideoOptionsMenu()
 {
     _video_options_menu.ClearOptions();
     _video_options_menu.SetPosition(512.0f, 338.0f);
-    _video_options_menu.SetDimensions(300.0f, 400.0f, 1, 6, 1, 6);
+    _video_options_menu.SetDimensions(300.0f, 400.0f, 1, 7, 1, 7);
     _video_options_menu.SetTextStyle(TextStyle("title22"));
     _video_options_menu.SetAlignment(VIDEO_X_CENTER, VIDEO_Y_CENTER);
     _video_options_menu.SetOptionAlignment(VIDEO_X_CENTER, VIDEO_Y_CENTER);
@@ -423,6 +436,9 @@ void GameOptionsMenuHandler::_SetupVideoOptionsMenu()
                                   &GameOptionsMenuHandler::_OnChangeVSyncRight);
     _video_options_menu.AddOption(UTranslate("Update method: "), this, &GameOptionsMenuHandler::_OnChangeGameUpdateMode,
                                   nullptr, nullptr, nullptr, nullptr);
+    _video_options_menu.AddOption(UTranslate("Map scaling: "), this, &GameOptionsMenuHandler::_OnChangeScaleFilterRight, nullptr, nullptr,
+                                  &GameOptionsMenuHandler::_OnChangeScaleFilterLeft,
+                                  &GameOptionsMenuHandler::_OnChangeScaleFilterRight);
     _video_options_menu.AddOption(UTranslate("UI Theme: "), this, &GameOptionsMenuHandler::_OnUIThemeRight, nullptr, nullptr,
                                   &GameOptionsMenuHandler::_OnUIThemeLeft, &GameOptionsMenuHandler::_OnUIThemeRight);
 
@@ -529,7 +545,7 @@ void GameOptionsMenuHandler::_SetupKeySettingsMenu()
     _key_settings_menu.AddOption(UTranslate("Menu: "), this, &GameOptionsMenuHandler::_RedefineMenuKey);
     _key_settings_menu.AddOption(UTranslate("Toggle Map: "), this, &GameOptionsMenuHandler::_RedefineMinimapKey);
     _key_settings_menu.AddOption(UTranslate("Pause: "), this, &GameOptionsMenuHandler::_RedefinePauseKey);
-    _key_settings_menu.AddOption(UTranslate("Restore defaults"), this, &GameOptionsMenuHandler::_OnRestoreDefaultKeys);
+    _key_settings_menu.AddTranslatableOption("Restore defaults", this, &GameOptionsMenuHandler::_OnRestoreDefaultKeys);
 }
 
 void GameOptionsMenuHandler::_SetupJoySettingsMenu()
@@ -563,7 +579,7 @@ void GameOptionsMenuHandler::_SetupJoySettingsMenu()
     _joy_settings_menu.AddOption(dummy, this, &GameOptionsMenuHandler::_RedefineHelpJoy);
     _joy_settings_menu.AddOption(dummy, this, &GameOptionsMenuHandler::_RedefineQuitJoy);
 
-    _joy_settings_menu.AddOption(UTranslate("Restore defaults"), this, &GameOptionsMenuHandler::_OnRestoreDefaultJoyButtons);
+    _joy_settings_menu.AddTranslatableOption("Restore defaults", this, &GameOptionsMenuHandler::_OnRestoreDefaultJoyButtons);
 }
 
 void GameOptionsMenuHandler::_SetupResolutionMenu()
@@ -727,6 +743,24 @@ void GameOptionsMenuHandler::_RefreshVideoOptions()
         _video_options_menu.EnableOption(4, false);
     }
 
+    // Update the map scaling filter
+    std::string scale_filter_str;
+    /// Translators: Do not translate the part before the '|'.
+    /// It is used for contextual translation support.
+    switch(VideoManager->GetScaleFilter()) {
+    case VIDEO_SCALE_FILTER_NEAREST:
+        scale_filter_str = CTranslate("ScaleFilter|Nearest");
+        break;
+    case VIDEO_SCALE_FILTER_INTEGER:
+        scale_filter_str = CTranslate("ScaleFilter|Integer");
+        break;
+    default:
+    case VIDEO_SCALE_FILTER_SHARP_BILINEAR:
+        scale_filter_str = CTranslate("ScaleFilter|Sharp Bilinear");
+        break;
+    }
+    _video_options_menu.SetOptionText(SCALE_FILTER_MENU_INDEX, UTranslate("Map scaling: ") + MakeUnicodeString(scale_filter_str));
+
     // Update the UI theme.
     _video_options_menu.SetOptionText(SKIN_MENU_INDEX, UTranslate("UI Theme: ") + GUIManager->GetDefaultMenuSkinName());
 }
@@ -962,6 +996,28 @@ void GameOptionsMenuHandler::_OnChangeGameUpdateMode()
     _has_modified_settings = true;
 }
 
+void GameOptionsMenuHandler::_OnChangeScaleFilterLeft()
+{
+    uint32_t scale_filter = VideoManager->GetScaleFilter();
+    if (scale_filter == 0)
+        scale_filter = VIDEO_SCALE_FILTER_TOTAL - 1;
+    else
+        --scale_filter;
+    VideoManager->SetScaleFilter(static_cast<VIDEO_SCALE_FILTER>(scale_filter));
+    _RefreshVideoOptions();
+    _has_modified_settings = true;
+}
+
+void GameOptionsMenuHandler::_OnChangeScaleFilterRight()
+{
+    uint32_t scale_filter = VideoManager->GetScaleFilter() + 1;
+    if (scale_filter >= VIDEO_SCALE_FILTER_TOTAL)
+        scale_filter = 0;
+    VideoManager->SetScaleFilter(static_cast<VIDEO_SCALE_FILTER>(scale_filter));
+    _RefreshVideoOptions();
+    _has_modified_settings = true;
+}
+
 void GameOptionsMenuHandler::_OnUIThemeLeft()
 {
     GUIManager->SetPreviousDefaultMenuSkin();
@@ -1338,6 +1394,13 @@ bool GameOptionsMenuHandler::_SaveSettingsFile(const std::string& filename)
     settings_lua.WriteUInt("vsync_mode", VideoManager->GetVSyncMode());
     settings_lua.WriteComment("The game update loop mode. 'false' for a more gentle update loop, 'true' for performance.");
     settings_lua.WriteBool("game_update_mode", VideoManager->GetGameUpdateMode());
+    settings_lua.WriteComment("Whether the visual effects quality is lowered when the game can't keep up with the target frame rate.");
+    settings_lua.WriteBool("adaptive_quality", VideoManager->IsAdaptiveQualityEnabled());
+    settings_lua.WriteComment("The resolution the maps are drawn at before being scaled to the screen.");
+    settings_lua.WriteUInt("internal_resx", VideoManager->GetInternalWidth());
+    settings_lua.WriteUInt("internal_resy", VideoManager->GetInternalHeight());
+    settings_lua.WriteComment("The map scaling filter. 0: Nearest, 1: Integer, 2: Sharp Bilinear");
+    settings_lua.WriteUInt("scale_filter", VideoManager->GetScaleFilter());
     settings_lua.WriteComment("The UI Theme to load.");
     settings_lua.WriteString("ui_theme", GUIManager->GetDefaultMenuSkinId());
     settings_lua.EndTable(); // video_settings
@@ -77,6 +77,18 @@ public:
                    void (GameOptionsMenuHandler::*left_function)() = nullptr,
                    void (GameOptionsMenuHandler::*right_function)() = nullptr);
 
+    /** \brief Adds a new option translated from the given message id, with the desired function pointers attached
+    *** \param message_id The untranslated text of the new option, translated again when the language changes
+    *** \see AddOption()
+    **/
+    void AddTranslatableOption(const std::string &message_id,
+                               GameOptionsMenuHandler* handler,
+                               void (GameOptionsMenuHandler::*confirm_function)() = nullptr,
+                               void (GameOptionsMenuHandler::*up_function)() = nullptr,
+                               void (GameOptionsMenuHandler::*down_function)() = nullptr,
+                               void (GameOptionsMenuHandler::*left_function)() = nullptr,
+                               void (GameOptionsMenuHandler::*right_function)() = nullptr);
+
     //! \brief
     //@{
     void InputConfirm();
@@ -104,6 +116,12 @@ private:
 
     //! \brief Right input handlers for all options in the menu
     std::vector<void (GameOptionsMenuHandler::*)()> _right_handlers;
+
+    //! \brief Attaches the given function pointers to the last added option
+    void _AddHandlers(GameOptionsMenuHandler* handler,
+                      void (GameOptionsMenuHandler::*confirm_function)(),
+                      void (GameOptionsMenuHandler::*up_function)(), void (GameOptionsMenuHandler::*down_function)(),
+                      void (GameOptionsMenuHandler::*left_function)(), void (GameOptionsMenuHandler::*right_function)());
 }; // class GameOptionsMenuHandlerMenu : public vt_video::OptionBox
 
 
@@ -148,8 +166,9 @@ public:
         return _first_run;
     }
 
-    //! \brief Reloads the menu including translatable texts to clearly show
-    //! The change there.
+    //! \brief Makes the translated texts show the new language.
+    //! Translatable options are translated again lazily on their next draw,
+    //! so only the parent mode texts and the window title are updated here.
     void ReloadTranslatableMenus();
 
 private:
@@ -247,6 +266,8 @@ private:
     void _OnChangeVSyncLeft();
     void _OnChangeVSyncRight();
     void _OnChangeGameUpdateMode();
+    void _OnChangeScaleFilterLeft();
+    void _OnChangeScaleFilterRight();
     void _OnUIThemeLeft();
     void _OnUIThemeRight();
     //@}
@@ -23,9 +23,11 @@
 
 #include "utils/utils_pch.h"
 #include "engine/audio/audio.h"
+#include "engine/audio/layered_music.h"
 
 #include "engine/system.h"
 #include "engine/mode_manager.h"
+#include "engine/video/video.h"
 
 #include "utils/utils_strings.h"
 #include "utils/utils_files.h"
@@ -41,15 +43,62 @@ AudioEngine *AudioManager = nullptr;
 bool AUDIO_DEBUG = false;
 bool AUDIO_ENABLE = true;
 
+namespace private_audio
+{
+
+void AudioTelemetry::Reset()
+{
+    refill_count = 0;
+    total_refill_time = 0;
+    max_refill_time = 0;
+    total_decode_time = 0;
+    max_decode_time = 0;
+    max_update_interval = 0;
+    underrun_count = 0;
+    lowest_buffer_fill = NUMBER_STREAMING_BUFFERS;
+    max_sources_used = 0;
+    source_steals = 0;
+    source_starvations = 0;
+    max_buffer_names_used = 0;
+    buffer_names_generated = 0;
+    max_decode_blocks_used = 0;
+    decode_blocks_allocated = 0;
+}
+
+void AudioTelemetry::AddRefill(uint32_t refill_time, uint32_t decode_time)
+{
+    ++refill_count;
+    total_refill_time += refill_time;
+    total_decode_time += decode_time;
+    if(refill_time > max_refill_time)
+        max_refill_time = refill_time;
+    if(decode_time > max_decode_time)
+        max_decode_time = decode_time;
+}
+
+} // namespace private_audio
+
 AudioEngine::AudioEngine() :
-    _sound_volume(1.0f),
-    _music_volume(1.0f),
     _device(0),
     _context(0),
     _max_sources(MAX_DEFAULT_AUDIO_SOURCES),
     _active_music(nullptr),
+    _buffer_names_used(0),
+    _decode_blocks_used(0),
+    _telemetry_start_time(0),
+    _last_update_time(0),
+    _telemetry_text(nullptr),
     _max_cache_size(MAX_DEFAULT_AUDIO_SOURCES / 4)
-{}
+{
+    _buses[AUDIO_BUS_MUSIC].parent = AUDIO_BUS_MASTER;
+    _buses[AUDIO_BUS_SFX].parent = AUDIO_BUS_MASTER;
+    _buses[AUDIO_BUS_AMBIENCE].parent = AUDIO_BUS_SFX;
+    _buses[AUDIO_BUS_UI].parent = AUDIO_BUS_SFX;
+    _buses[AUDIO_BUS_VOICE].parent = AUDIO_BUS_SFX;
+
+    // The menu sounds must be heard while the game is paused.
+    _buses[AUDIO_BUS_UI].ignores_parent_pause = true;
+}
 
 bool AudioEngine::SingletonInitialize()
 {
@@ -145,11 +194,26 @@ bool AudioEngine::SingletonInitialize()
         return false;
     }
 
+    // Fill the buffer names and decode blocks pools, so that the first musics don't allocate any
+    ALuint buffer_names[AUDIO_BUFFER_POOL_INITIAL_SIZE];
+    alGenBuffers(AUDIO_BUFFER_POOL_INITIAL_SIZE, buffer_names);
+    if(CheckALError()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "failed to fill the buffer names pool: " << CreateALErrorString() << std::endl;
+    }
+    else {
+        _free_buffer_names.assign(buffer_names, buffer_names + AUDIO_BUFFER_POOL_INITIAL_SIZE);
+    }
+
+    for(uint32_t i = 0; i < AUDIO_DECODE_BLOCK_POOL_INITIAL_SIZE; ++i)
+        _free_decode_blocks.push_back(new uint8_t[AUDIO_DECODE_BLOCK_SIZE]);
+
     return true;
 } // bool AudioEngine::SingletonInitialize()
 
 AudioEngine::~AudioEngine()
 {
+    delete _telemetry_text;
+
     if(!AUDIO_ENABLE)
         return;
 
@@ -185,6 +249,16 @@ AudioEngine::~AudioEngine()
             it = _registered_sounds.erase(it);
         }
     }
+    // The layered musics are owned by their users, but their layers must be freed before the sources.
+    if(!_registered_layered_music.empty()) {
+        PRINT_WARNING << _registered_layered_music.size() << " LayeredMusic objects were still "
+                      "registered when the destructor was invoked, their layers will be freed now." << std::endl;
+        for(std::vector<LayeredMusic *>::iterator it = _registered_layered_music.begin();
+                it != _registered_layered_music.end(); ++it) {
+            (*it)->FreeLayers();
+        }
+        _registered_layered_music.clear();
+    }
     if(!_registered_music.empty()) {
         PRINT_WARNING << _registered_music.size() << " MusicDescriptor objects were still "
                       "registered when the destructor was invoked, "
@@ -202,6 +276,23 @@ AudioEngine::~AudioEngine()
         }
     }
 
+    // Every descriptor is freed at this point, so the remaining static buffers were leaked.
+    for(std::map<std::string, StaticAudioBuffer *>::iterator it = _static_buffers.begin();
+            it != _static_buffers.end(); ++it) {
+        PRINT_WARNING << "This static audio buffer was never released: " << it->first << std::endl;
+        delete it->second;
+    }
+    _static_buffers.clear();
+
+    // Empty the pools
+    if(!_free_buffer_names.empty())
+        alDeleteBuffers(static_cast<ALsizei>(_free_buffer_names.size()), &_free_buffer_names[0]);
+    _free_buffer_names.clear();
+
+    for(uint32_t i = 0; i < _free_decode_blocks.size(); ++i)
+        delete[] _free_decode_blocks[i];
+    _free_decode_blocks.clear();
+
     alcMakeContextCurrent(0);
     alcDestroyContext(_context);
     alcCloseDevice(_device);
@@ -212,48 +303,132 @@ void AudioEngine::Update()
     if(!AUDIO_ENABLE)
         return;
 
+    _UpdateBusGains(SystemManager->GetUpdateTime());
+
     for(std::vector<AudioSource *>::iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
         if((*i)->owner) {
             (*i)->owner->_Update();
         }
     }
+
+    for(std::vector<LayeredMusic *>::iterator i = _registered_layered_music.begin(); i != _registered_layered_music.end(); ++i)
+        (*i)->_Update();
+
+    _UpdateTelemetry();
+}
+
+float AudioEngine::GetBusVolume(AUDIO_BUS bus) const
+{
+    if(bus >= AUDIO_BUS_TOTAL)
+        return 0.0f;
+    return _buses[bus].volume;
 }
 
-void AudioEngine::SetSoundVolume(float volume)
+void AudioEngine::SetBusVolume(AUDIO_BUS bus, float volume)
 {
+    if(bus >= AUDIO_BUS_TOTAL) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "invalid bus: " << bus << std::endl;
+        return;
+    }
+
     if(volume < 0.0f) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "tried to set sound volume less than 0.0f" << std::endl;
-        _sound_volume = 0.0f;
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "tried to set bus volume less than 0.0f: " << volume << std::endl;
+        volume = 0.0f;
     } else if(volume > 1.0f) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "tried to set sound volume greater than 1.0f" << std::endl;
-        _sound_volume = 1.0f;
-    } else {
-        _sound_volume = volume;
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "tried to set bus volume greater than 1.0f: " << volume << std::endl;
+        volume = 1.0f;
+    }
+    _buses[bus].volume = volume;
+
+    // Apply the new volume right away, as the audio engine may not be updated before long (e.g. while loading).
+    _UpdateBusGains(0);
+}
+
+void AudioEngine::PauseBus(AUDIO_BUS bus)
+{
+    if(bus >= AUDIO_BUS_TOTAL || _buses[bus].paused)
+        return;
+
+    _buses[bus].paused = true;
+    _buses[bus].pause_owner = vt_mode_manager::ModeManager ? vt_mode_manager::ModeManager->GetTop() : nullptr;
+
+    // The layers of a layered music are paused in one call, to stay aligned.
+    if(_IsBusInTree(AUDIO_BUS_MUSIC, bus)) {
+        for(std::vector<LayeredMusic *>::iterator i = _registered_layered_music.begin(); i != _registered_layered_music.end(); ++i)
+            (*i)->_PauseLayers(true);
     }
 
-    for(std::vector<SoundDescriptor *>::iterator i = _registered_sounds.begin(); i != _registered_sounds.end(); ++i) {
-        if((*i)->_source != nullptr) {
-            alSourcef((*i)->_source->source, AL_GAIN, _sound_volume * (*i)->GetVolume());
+    // Only audio owning a source can be playing
+    for(std::vector<AudioSource *>::iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
+        AudioDescriptor *audio = (*i)->owner;
+        if(!audio || !_IsBusInTree(audio->_bus, bus))
+            continue;
+
+        AUDIO_STATE state = audio->GetState();
+        if(state == AUDIO_STATE_PLAYING || state == AUDIO_STATE_FADE_IN || state == AUDIO_STATE_FADE_OUT) {
+            audio->Pause();
+            audio->_paused_by_bus = true;
         }
     }
 }
 
-void AudioEngine::SetMusicVolume(float volume)
+void AudioEngine::ResumeBus(AUDIO_BUS bus)
 {
-    if(volume < 0.0f) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "tried to set music volume less than 0.0f: " << volume << std::endl;
-        _music_volume = 0.0f;
-    } else if(volume > 1.0f) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "tried to set music volume greater than 1.0f: " << volume << std::endl;
-        _music_volume = 1.0f;
-    } else {
-        _music_volume = volume;
+    if(bus >= AUDIO_BUS_TOTAL || !_buses[bus].paused)
+        return;
+
+    _buses[bus].paused = false;
+    _buses[bus].pause_owner = nullptr;
+
+    if(_IsBusInTree(AUDIO_BUS_MUSIC, bus)) {
+        for(std::vector<LayeredMusic *>::iterator i = _registered_layered_music.begin(); i != _registered_layered_music.end(); ++i)
+            (*i)->_ResumeLayers(true);
     }
 
-    for(std::vector<MusicDescriptor *>::iterator i = _registered_music.begin(); i != _registered_music.end(); ++i) {
-        if((*i)->_source != nullptr) {
-            alSourcef((*i)->_source->source, AL_GAIN, _music_volume * (*i)->GetVolume());
-        }
+    for(std::vector<AudioSource *>::iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
+        AudioDescriptor *audio = (*i)->owner;
+        if(!audio || !audio->_paused_by_bus || !_IsBusInTree(audio->_bus, bus))
+            continue;
+
+        // The audio stays paused when another parent bus is still paused.
+        if(IsBusPaused(audio->_bus))
+            continue;
+
+        audio->_paused_by_bus = false;
+        audio->Resume();
+    }
+}
+
+bool AudioEngine::IsBusPaused(AUDIO_BUS bus) const
+{
+    while(bus < AUDIO_BUS_TOTAL) {
+        if(_buses[bus].paused)
+            return true;
+        if(_buses[bus].ignores_parent_pause)
+            return false;
+        bus = _buses[bus].parent;
+    }
+    return false;
+}
+
+void AudioEngine::DuckBus(AUDIO_BUS bus, float gain, float time)
+{
+    if(bus >= AUDIO_BUS_TOTAL)
+        return;
+
+    AudioBus &audio_bus = _buses[bus];
+    audio_bus.duck_target = (gain < 0.0f) ? 0.0f : ((gain > 1.0f) ? 1.0f : gain);
+    if(audio_bus.duck_target < 1.0f)
+        audio_bus.duck_owner = vt_mode_manager::ModeManager ? vt_mode_manager::ModeManager->GetTop() : nullptr;
+    else
+        audio_bus.duck_owner = nullptr;
+    if(time <= 0.0f) {
+        audio_bus.duck_gain = audio_bus.duck_target;
+        audio_bus.duck_speed = 0.0f;
+        _UpdateBusGains(0);
+    }
+    else {
+        audio_bus.duck_speed = std::abs(audio_bus.duck_target - audio_bus.duck_gain) / time;
     }
 }
 
@@ -487,6 +662,15 @@ void AudioEngine::RemoveGameModeOwner(vt_mode_manager::GameMode* gm)
     if(!gm)
         return;
 
+    // Restore the buses the game mode left paused or ducked.
+    for(uint32_t i = 0; i < AUDIO_BUS_TOTAL; ++i) {
+        AUDIO_BUS bus = static_cast<AUDIO_BUS>(i);
+        if(_buses[i].pause_owner == gm)
+            ResumeBus(bus);
+        if(_buses[i].duck_owner == gm)
+            UnduckBus(bus);
+    }
+
     // Tells all audio descriptor the owner can be removed.
     std::map<std::string, AudioCacheElement>::iterator it = _audio_cache.begin();
     for(; it != _audio_cache.end();) {
@@ -576,6 +760,22 @@ void AudioEngine::DEBUG_PrintInfo()
     }
 }
 
+void AudioEngine::DEBUG_DrawTelemetry()
+{
+    if(!AUDIO_ENABLE)
+        return;
+
+    if(!_telemetry_text)
+        _telemetry_text = new vt_video::TextImage(_GetTelemetrySummary(), vt_video::TextStyle("text20", vt_video::Color::white));
+
+    vt_video::VideoManager->PushState();
+    vt_video::VideoManager->SetStandardCoordSys();
+    vt_video::VideoManager->SetDrawFlags(vt_video::VIDEO_X_LEFT, vt_video::VIDEO_Y_BOTTOM, vt_video::VIDEO_BLEND, 0);
+    vt_video::VideoManager->Move(10.0f, 760.0f); // Lower left hand corner of the screen
+    _telemetry_text->Draw();
+    vt_video::VideoManager->PopState();
+}
+
 private_audio::AudioSource *AudioEngine::_AcquireAudioSource()
 {
     // (1) Find and return the first source that does not have an owner
@@ -592,11 +792,13 @@ private_audio::AudioSource *AudioEngine::_AcquireAudioSource()
         if(state == AL_INITIAL || state == AL_STOPPED) {
             (*i)->owner->_source = nullptr;
             (*i)->Reset(); // this call sets the source owner pointer to nullptr
+            ++_telemetry.source_steals;
             return *i;
         }
     }
 
     // (3) Return nullptr in the (extremely rare) case that all sources are owned and actively playing or paused
+    ++_telemetry.source_starvations;
     return nullptr;
 }
 
@@ -673,4 +875,298 @@ bool AudioEngine::_LoadAudio(const std::string &filename, bool is_music, vt_mode
     return true;
 } // bool AudioEngine::_LoadAudio(AudioDescriptor* audio, const std::string& filename)
 
+ALuint AudioEngine::_AcquireBufferName()
+{
+    ALuint buffer_name = 0;
+    if(!_free_buffer_names.empty()) {
+        buffer_name = _free_buffer_names.back();
+        _free_buffer_names.pop_back();
+    }
+    else {
+        CheckALError(); // Clears errors
+        alGenBuffers(1, &buffer_name);
+        if(CheckALError()) {
+            IF_PRINT_WARNING(AUDIO_DEBUG) << "OpenAL error detected after buffer generation: "
+                                          << CreateALErrorString() << std::endl;
+            return 0;
+        }
+        ++_telemetry.buffer_names_generated;
+    }
+
+    ++_buffer_names_used;
+    if(_buffer_names_used > _telemetry.max_buffer_names_used)
+        _telemetry.max_buffer_names_used = _buffer_names_used;
+    return buffer_name;
+}
+
+void AudioEngine::_ReleaseBufferName(ALuint buffer_name)
+{
+    if(_buffer_names_used > 0)
+        --_buffer_names_used;
+
+    if(_free_buffer_names.size() >= AUDIO_BUFFER_POOL_MAX_SIZE) {
+        alDeleteBuffers(1, &buffer_name);
+        return;
+    }
+
+    // Free the buffer data while it is unused
+    alBufferData(buffer_name, AL_FORMAT_MONO8, nullptr, 0, 11025);
+    CheckALError(); // Clears errors, since some implementations refuse empty data
+    _free_buffer_names.push_back(buffer_name);
+}
+
+uint8_t *AudioEngine::_AcquireDecodeBlock(uint32_t size)
+{
+    if(size > AUDIO_DECODE_BLOCK_SIZE) {
+        ++_telemetry.decode_blocks_allocated;
+        return new uint8_t[size];
+    }
+
+    uint8_t *block = nullptr;
+    if(!_free_decode_blocks.empty()) {
+        block = _free_decode_blocks.back();
+        _free_decode_blocks.pop_back();
+    }
+    else {
+        block = new uint8_t[AUDIO_DECODE_BLOCK_SIZE];
+        ++_telemetry.decode_blocks_allocated;
+    }
+
+    ++_decode_blocks_used;
+    if(_decode_blocks_used > _telemetry.max_decode_blocks_used)
+        _telemetry.max_decode_blocks_used = _decode_blocks_used;
+    return block;
+}
+
+void AudioEngine::_ReleaseDecodeBlock(uint8_t *block, uint32_t size)
+{
+    if(size > AUDIO_DECODE_BLOCK_SIZE) {
+        delete[] block;
+        return;
+    }
+
+    if(_decode_blocks_used > 0)
+        --_decode_blocks_used;
+
+    if(_free_decode_blocks.size() >= AUDIO_DECODE_BLOCK_POOL_MAX_SIZE)
+        delete[] block;
+    else
+        _free_decode_blocks.push_back(block);
+}
+
+void AudioEngine::_UpdateBusGains(uint32_t update_time)
+{
+    bool gain_changed = false;
+
+    // Parent buses are listed before their children, so their gain is always computed first.
+    for(uint32_t i = 0; i < AUDIO_BUS_TOTAL; ++i) {
+        AudioBus &bus = _buses[i];
+
+        if(bus.duck_gain != bus.duck_target) {
+            float step = bus.duck_speed * static_cast<float>(update_time);
+            if(bus.duck_gain < bus.duck_target)
+                bus.duck_gain = std::min(bus.duck_gain + step, bus.duck_target);
+            else
+                bus.duck_gain = std::max(bus.duck_gain - step, bus.duck_target);
+        }
+
+        float gain = bus.volume * bus.duck_gain;
+        if(bus.parent < AUDIO_BUS_TOTAL)
+            gain *= _buses[bus.parent].gain;
+
+        bus.gain_changed = (gain != bus.gain);
+        bus.gain = gain;
+        gain_changed = gain_changed || bus.gain_changed;
+    }
+
+    if(!gain_changed)
+        return;
+
+    for(std::vector<AudioSource *>::iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
+        AudioDescriptor *audio = (*i)->owner;
+        if(audio && _buses[audio->_bus].gain_changed)
+            audio->_UpdateSourceGain();
+    }
+}
+
+bool AudioEngine::_IsBusInTree(AUDIO_BUS bus, AUDIO_BUS ancestor) const
+{
+    while(bus < AUDIO_BUS_TOTAL) {
+        if(bus == ancestor)
+            return true;
+        if(_buses[bus].ignores_parent_pause)
+            return false;
+        bus = _buses[bus].parent;
+    }
+    return false;
+}
+
+void AudioEngine::_UpdateTelemetry()
+{
+    uint32_t current_time = SDL_GetTicks();
+    if(_telemetry_start_time == 0)
+        _telemetry_start_time = current_time;
+    if(_last_update_time != 0 && current_time - _last_update_time > _telemetry.max_update_interval)
+        _telemetry.max_update_interval = current_time - _last_update_time;
+    _last_update_time = current_time;
+
+    uint32_t sources_used = 0;
+    for(std::vector<AudioSource *>::iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
+        if((*i)->owner)
+            ++sources_used;
+    }
+    if(sources_used > _telemetry.max_sources_used)
+        _telemetry.max_sources_used = sources_used;
+
+    if(current_time - _telemetry_start_time < AUDIO_TELEMETRY_PERIOD)
+        return;
+
+    _last_telemetry = _telemetry;
+    std::string summary = _GetTelemetrySummary();
+    if(_last_telemetry.underrun_count > 0) {
+        PRINT_WARNING << _last_telemetry.underrun_count << " audio stream underrun(s) during the last "
+                      << AUDIO_TELEMETRY_PERIOD / 1000 << " seconds:" << std::endl << summary << std::endl;
+    }
+    else {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "Audio telemetry:" << std::endl << summary << std::endl;
+    }
+    if(_telemetry_text)
+        _telemetry_text->SetText(summary);
+
+    // Start a new period, the pools usage peaks starting from the current usage
+    _telemetry.Reset();
+    _telemetry.max_buffer_names_used = _buffer_names_used;
+    _telemetry.max_decode_blocks_used = _decode_blocks_used;
+    _telemetry_start_time = current_time;
+    for(std::vector<AudioSource *>::iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
+        if((*i)->owner)
+            (*i)->owner->_lowest_buffer_fill = NUMBER_STREAMING_BUFFERS;
+    }
+}
+
+std::string AudioEngine::_GetTelemetrySummary() const
+{
+    const AudioTelemetry &telemetry = _last_telemetry;
+    std::ostringstream summary;
+    summary << "Audio sources: " << telemetry.max_sources_used << "/" << _max_sources << " peak, "
+            << telemetry.source_steals << " taken back, " << telemetry.source_starvations << " starved" << std::endl;
+
+    uint32_t average_refill_time = 0;
+    uint32_t average_decode_time = 0;
+    if(telemetry.refill_count > 0) {
+        average_refill_time = static_cast<uint32_t>(telemetry.total_refill_time / telemetry.refill_count);
+        average_decode_time = static_cast<uint32_t>(telemetry.total_decode_time / telemetry.refill_count);
+    }
+    summary << "Stream refills: " << telemetry.refill_count
+            << ", time avg/max: " << average_refill_time << "/" << telemetry.max_refill_time << " us"
+            << ", decode avg/max: " << average_decode_time << "/" << telemetry.max_decode_time << " us" << std::endl;
+    summary << "Refill latency max: " << telemetry.max_update_interval << " ms, underruns: " << telemetry.underrun_count
+            << ", lowest buffer fill: " << telemetry.lowest_buffer_fill << "/" << NUMBER_STREAMING_BUFFERS << std::endl;
+    summary << "Buffer pool: " << telemetry.max_buffer_names_used << " used peak, " << _free_buffer_names.size()
+            << " free, " << telemetry.buffer_names_generated << " generated"
+            << " - Decode blocks: " << telemetry.max_decode_blocks_used << " used peak, " << _free_decode_blocks.size()
+            << " free, " << telemetry.decode_blocks_allocated << " allocated";
+
+    // The fill level of every stream currently owning a source
+    for(std::vector<AudioSource *>::const_iterator i = _audio_sources.begin(); i != _audio_sources.end(); ++i) {
+        const AudioDescriptor *audio = (*i)->owner;
+        if(!audio || !audio->_stream)
+            continue;
+        summary << std::endl << " - " << audio->GetFilename() << ": lowest fill "
+                << audio->_lowest_buffer_fill << "/" << NUMBER_STREAMING_BUFFERS;
+    }
+    return summary.str();
+}
+
+StaticAudioBuffer *AudioEngine::_AcquireStaticBuffer(const std::string &filename)
+{
+    std::map<std::string, StaticAudioBuffer *>::iterator it = _static_buffers.find(filename);
+    if(it != _static_buffers.end()) {
+        ++it->second->reference_count;
+        return it->second;
+    }
+
+    // Short Ogg files are read from the PCM cache when they were already decoded once.
+    const std::string cache_filename = GetPcmCacheFilename(filename);
+    AudioInput *input = nullptr;
+    if(!cache_filename.empty() && DoesFileExist(cache_filename)) {
+        input = new WavFile(filename, cache_filename);
+        if(input->Initialize() == false) {
+            IF_PRINT_WARNING(AUDIO_DEBUG) << "invalid PCM cache file, decoding the audio file again: " << cache_filename << std::endl;
+            delete input;
+            input = nullptr;
+        }
+    }
+    const bool read_from_cache = (input != nullptr);
+
+    if(input == nullptr) {
+        input = CreateAudioInput(filename);
+        if(input == nullptr)
+            return nullptr;
+
+        if(input->Initialize() == false) {
+            IF_PRINT_WARNING(AUDIO_DEBUG) << "failed to load and initialize audio file: " << filename << std::endl;
+            delete input;
+            return nullptr;
+        }
+    }
+
+    // Read the whole audio data to pass it to the OpenAL buffer, reusing the same block for all static audio.
+    if(_static_decode_block.size() < input->GetDataSize())
+        _static_decode_block.resize(input->GetDataSize());
+    uint8_t *data = _static_decode_block.empty() ? nullptr : &_static_decode_block[0];
+    bool all_data_read = false;
+    if(data == nullptr || input->Read(data, input->GetTotalNumberSamples(), all_data_read) != input->GetTotalNumberSamples()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "failed to read entire audio data stream for file: " << filename << std::endl;
+        delete input;
+        _TrimStaticDecodeBlock();
+        return nullptr;
+    }
+
+    if(!read_from_cache && !cache_filename.empty())
+        WritePcmCacheFile(cache_filename, input, data);
+
+    StaticAudioBuffer *static_buffer = new StaticAudioBuffer();
+    static_buffer->input = input;
+    static_buffer->format = GetAudioInputFormat(input);
+    static_buffer->buffer.FillBuffer(data, static_buffer->format, input->GetDataSize(), input->GetSamplesPerSecond());
+    _TrimStaticDecodeBlock();
+
+    if(!static_buffer->buffer.IsValid()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "could not create an OpenAL buffer for audio file: " << filename << std::endl;
+        delete static_buffer;
+        return nullptr;
+    }
+
+    static_buffer->reference_count = 1;
+    _static_buffers.insert(std::make_pair(filename, static_buffer));
+    return static_buffer;
+}
+
+void AudioEngine::_TrimStaticDecodeBlock()
+{
+    if(_static_decode_block.size() > STATIC_DECODE_BLOCK_MAX_KEPT_SIZE)
+        std::vector<uint8_t>().swap(_static_decode_block);
+}
+
+void AudioEngine::_ReleaseStaticBuffer(StaticAudioBuffer *static_buffer)
+{
+    if(static_buffer == nullptr)
+        return;
+
+    if(static_buffer->reference_count > 1) {
+        --static_buffer->reference_count;
+        return;
+    }
+
+    for(std::map<std::string, StaticAudioBuffer *>::iterator it = _static_buffers.begin();
+            it != _static_buffers.end(); ++it) {
+        if(it->second == static_buffer) {
+            _static_buffers.erase(it);
+            break;
+        }
+    }
+    delete static_buffer;
+}
+
 } // namespace vt_audio
@@ -30,11 +30,17 @@
 #include "audio_descriptor.h"
 #include "audio_effects.h"
 
+namespace vt_video
+{
+class TextImage;
+}
+
 //! \brief All related audio engine code is wrapped within this namespace
 namespace vt_audio
 {
 
 class AudioEngine;
+class LayeredMusic;
 
 //! \brief The singleton pointer responsible for all audio operations.
 extern AudioEngine *AudioManager;
@@ -51,6 +57,16 @@ namespace private_audio
 //! \brief The maximum default number of audio sources that the engine tries to create
 const uint16_t MAX_DEFAULT_AUDIO_SOURCES = 64;
 
+/** \brief The number of OpenAL buffer names and decode blocks created at initialization
+*** It is enough for two streaming musics, e.g. when cross-fading musics during a transition.
+**/
+const uint32_t AUDIO_BUFFER_POOL_INITIAL_SIZE = NUMBER_STREAMING_BUFFERS * 2;
+const uint32_t AUDIO_DECODE_BLOCK_POOL_INITIAL_SIZE = 2;
+
+//! \brief The maximum number of unused OpenAL buffer names and decode blocks kept in the pools
+const uint32_t AUDIO_BUFFER_POOL_MAX_SIZE = MAX_DEFAULT_AUDIO_SOURCES;
+const uint32_t AUDIO_DECODE_BLOCK_POOL_MAX_SIZE = 8;
+
 
 
 //! \brief A container class for an element of the LRU audio cache managed by the AudioEngine class
@@ -67,6 +83,128 @@ public:
     AudioDescriptor *audio;
 };
 
+/** ****************************************************************************
+*** \brief A mixing bus, grouping audio descriptors to control them together
+***
+*** The gain of a bus combines its volume, its ducking gain and the gain of its
+*** parent bus. The gains of all the buses are computed once per audio engine update,
+*** and only the sources attached to buses which gain changed get updated.
+*** ***************************************************************************/
+class AudioBus
+{
+public:
+    AudioBus() :
+        parent(AUDIO_BUS_TOTAL),
+        volume(1.0f),
+        duck_gain(1.0f),
+        duck_target(1.0f),
+        duck_speed(0.0f),
+        duck_owner(nullptr),
+        paused(false),
+        pause_owner(nullptr),
+        ignores_parent_pause(false),
+        gain(1.0f),
+        gain_changed(false) {}
+
+    //! \brief The parent bus, or AUDIO_BUS_TOTAL for the master bus
+    AUDIO_BUS parent;
+
+    //! \brief The volume level of the bus, set by the user (0.0f is mute, 1.0f is max)
+    float volume;
+
+    //! \brief The current ducking gain, going toward the ducking target at the given speed (gain per millisecond)
+    float duck_gain;
+    float duck_target;
+    float duck_speed;
+
+    //! \brief The game mode which ducked the bus, unducked when that mode is deleted
+    vt_mode_manager::GameMode *duck_owner;
+
+    //! \brief Whether the bus was paused, as a group
+    bool paused;
+
+    //! \brief The game mode which paused the bus, resumed when that mode is deleted
+    vt_mode_manager::GameMode *pause_owner;
+
+    //! \brief Whether the bus keeps playing when one of its parents is paused, as for the menu sounds
+    bool ignores_parent_pause;
+
+    //! \brief The resulting bus gain, including its parents ones
+    float gain;
+
+    //! \brief Set when the gain changed during the last computation
+    bool gain_changed;
+}; // class AudioBus
+
+//! \brief The duration in milliseconds of an audio telemetry period, after which the statistics are summarized
+const uint32_t AUDIO_TELEMETRY_PERIOD = 5000;
+
+/** ****************************************************************************
+*** \brief Statistics about the audio engine health gathered over a telemetry period
+***
+*** Streaming buffers are refilled during the audio engine update, so a buffer
+*** which finished playing waits at most one update interval before being refilled.
+*** When all the buffers of a stream finish playing before that, the source runs dry
+*** and an underrun is recorded. Durations are given in microseconds.
+*** ***************************************************************************/
+class AudioTelemetry
+{
+public:
+    AudioTelemetry()
+    { Reset(); }
+
+    //! \brief Resets all the statistics for a new period
+    void Reset();
+
+    //! \brief Records a streaming buffer refill and the time spent in it
+    void AddRefill(uint32_t refill_time, uint32_t decode_time);
+
+    //! \brief Returns a high resolution timestamp, to be given to GetElapsedTime()
+    static uint64_t GetTime() {
+        return SDL_GetPerformanceCounter();
+    }
+
+    //! \brief Returns the time elapsed since the given timestamp in microseconds
+    static uint32_t GetElapsedTime(uint64_t start_time) {
+        return static_cast<uint32_t>((SDL_GetPerformanceCounter() - start_time) * 1000000 / SDL_GetPerformanceFrequency());
+    }
+
+    //! \brief The number of streaming buffers refilled, and the total and maximum time taken by them
+    uint32_t refill_count;
+    uint64_t total_refill_time;
+    uint32_t max_refill_time;
+
+    //! \brief The total and maximum time spent decoding the data of a refilled buffer
+    uint64_t total_decode_time;
+    uint32_t max_decode_time;
+
+    //! \brief The longest interval between two audio updates, i.e. the worst refill latency, in milliseconds
+    uint32_t max_update_interval;
+
+    //! \brief The number of times a stream source stopped while data remained to be played
+    uint32_t underrun_count;
+
+    //! \brief The lowest number of streaming buffers still queued for playback, among all streams
+    uint32_t lowest_buffer_fill;
+
+    //! \brief The highest number of sources owned at the same time
+    uint32_t max_sources_used;
+
+    //! \brief The number of sources taken back from stopped audio to play other audio
+    uint32_t source_steals;
+
+    //! \brief The number of times no source at all could be given to audio
+    uint32_t source_starvations;
+
+    //! \brief The highest number of pooled OpenAL buffer names in use, and the number of names generated when the pool was empty
+    uint32_t max_buffer_names_used;
+    uint32_t buffer_names_generated;
+
+    //! \brief The highest number of pooled decode blocks in use, and the number of blocks allocated outside of the pool
+    uint32_t max_decode_blocks_used;
+    uint32_t decode_blocks_allocated;
+}; // class AudioTelemetry
+
 } // namespace private_audio
 
 /** ****************************************************************************
@@ -86,8 +224,10 @@ class AudioEngine : public vt_utils::Singleton<AudioEngine>
 // friend class private_audio::SoundData;
 // friend class private_audio::MusicData;
     friend class AudioDescriptor;
+    friend class private_audio::AudioBuffer;
     friend class SoundDescriptor;
     friend class MusicDescriptor;
+    friend class LayeredMusic;
     friend class Effects;
 
 public:
@@ -102,22 +242,58 @@ public:
     void Update();
 
     float GetSoundVolume() const {
-        return _sound_volume;
+        return GetBusVolume(AUDIO_BUS_SFX);
     }
 
     float GetMusicVolume() const {
-        return _music_volume;
+        return GetBusVolume(AUDIO_BUS_MUSIC);
     }
 
     /** \brief Sets the global volume level for all sounds
     *** \param volume The sound volume level to set. The valid range is: [0.0 (mute), 1.0 (max volume)]
     **/
-    void SetSoundVolume(float volume);
+    void SetSoundVolume(float volume) {
+        SetBusVolume(AUDIO_BUS_SFX, volume);
+    }
 
     /** \brief Sets the global volume level for all music
     *** \param volume The music volume level to set. The valid range is: [0.0 (mute), 1.0 (max volume)]
     **/
-    void SetMusicVolume(float volume);
+    void SetMusicVolume(float volume) {
+        SetBusVolume(AUDIO_BUS_MUSIC, volume);
+    }
+
+    /** \name Mixing Bus Functions
+    *** \brief Control groups of audio attached to the same bus, and to its children buses.
+    ***
+    *** Pausing a bus pauses the audio playing on it, and the audio starting to play
+    *** on it afterwards. Resuming the bus only resumes the audio it paused.
+    *** Ducking a bus lowers its gain until it is unducked, e.g. for the ambience during dialogues.
+    ***
+    *** The buses are owned by the game mode on top of the stack when they get paused
+    *** or ducked, and are resumed and unducked when that game mode is deleted.
+    **/
+    //@{
+    float GetBusVolume(AUDIO_BUS bus) const;
+
+    //! \param volume The bus volume level to set. The valid range is: [0.0 (mute), 1.0 (max volume)]
+    void SetBusVolume(AUDIO_BUS bus, float volume);
+
+    void PauseBus(AUDIO_BUS bus);
+    void ResumeBus(AUDIO_BUS bus);
+
+    //! \brief Tells whether the bus, or one of its parents, is paused
+    bool IsBusPaused(AUDIO_BUS bus) const;
+
+    /** \param gain The gain to lower the bus to, in the [0.0, 1.0] range
+    *** \param time The time in ms to reach that gain.
+    **/
+    void DuckBus(AUDIO_BUS bus, float gain, float time = 300.0f);
+
+    void UnduckBus(AUDIO_BUS bus, float time = 300.0f) {
+        DuckBus(bus, 1.0f, time);
+    }
+    //@}
 
     /** \name Global Audio State Manipulation Functions
     *** \brief Performs specified operation on all sounds and music.
@@ -125,19 +301,19 @@ public:
     *** These functions will only effect audio data that is in the state(s) specified below:
     *** - PlayAudio()     <==>   all states but the playing state
     *** - PauseAudio()    <==>   playing state
-    *** - ResumeAudio()   <==>   paused state
+    *** - ResumeAudio()   <==>   paused state, when paused by PauseAudio()
+    ***
+    *** \note The UI bus ignores the master bus pause, so that menus stay audible.
     *** - StopAudio()     <==>   all states but the stopped state
     *** - RewindAudio()   <==>   all states
     **/
     //@{
     void PauseAudio() {
-        PauseAllSounds();
-        PauseActiveMusic();
+        PauseBus(AUDIO_BUS_MASTER);
     }
 
     void ResumeAudio() {
-        ResumeAllSounds();
-        ResumeActiveMusic();
+        ResumeBus(AUDIO_BUS_MASTER);
     }
 
     void StopAudio() {
@@ -290,7 +466,7 @@ public:
     /**
     *** Tells the audio engine that a game mode ended.
     *** Thus, permitting to check whether the audio descriptors owned by the mode can be freed
-    *** from memory.
+    *** from memory, and resuming and unducking the buses the mode paused or ducked.
     **/
     void RemoveGameModeOwner(vt_mode_manager::GameMode *gm);
 
@@ -333,6 +509,9 @@ public:
     //! \brief Prints information about the audio properties and settings of the user's machine
     void DEBUG_PrintInfo();
 
+    //! \brief Draws the audio telemetry of the last period, along with the streams buffers fill levels.
+    void DEBUG_DrawTelemetry();
+
 private:
     //! \note Constructors are kept private since this class is a singleton
     //@{
@@ -340,11 +519,8 @@ private:
     AudioEngine(const AudioEngine &game_audio);
     //@}
 
-    //! \brief The global volume level of all sounds (0.0f is mute, 1.0f is max)
-    float _sound_volume;
-
-    //! \brief The global volume level of all music (0.0f is mute, 1.0f is max)
-    float _music_volume;
+    //! \brief The mixing buses, indexed by AUDIO_BUS
+    private_audio::AudioBus _buses[AUDIO_BUS_TOTAL];
 
     //! \brief The OpenAL device currently being utilized by the audio engine
     ALCdevice *_device;
@@ -383,6 +559,9 @@ private:
     std::vector<MusicDescriptor *> _registered_music;
     //@}
 
+    //! \brief The layered musics created, updated along with the audio engine
+    std::vector<LayeredMusic *> _registered_layered_music;
+
     /** \brief A LRU cache of audio which is managed internally by the audio engine
     *** The purpose of this cache is to allow the user to quickly and easily play
     *** sounds and music without having to maintain a Sound//MusicDescriptor object in memory.
@@ -397,6 +576,42 @@ private:
     **/
     std::map<std::string, private_audio::AudioCacheElement> _audio_cache;
 
+    /** \brief The shared buffers of statically loaded audio, indexed by filename
+    *** Every static audio descriptor loading the same file uses the same buffer,
+    *** so that each file is decoded and uploaded to OpenAL only once.
+    **/
+    std::map<std::string, private_audio::StaticAudioBuffer *> _static_buffers;
+
+    /** \brief The pool of unused OpenAL buffer names, and the number of names in use
+    *** Buffer names are borrowed and returned by the AudioBuffer class, so that loading
+    *** and freeing audio doesn't generate and delete OpenAL buffers each time.
+    **/
+    std::vector<ALuint> _free_buffer_names;
+    uint32_t _buffer_names_used;
+
+    /** \brief The pool of unused decode blocks of AUDIO_DECODE_BLOCK_SIZE bytes, and the number of blocks in use
+    *** Streaming audio descriptors decode their data into those blocks before filling their buffers.
+    **/
+    std::vector<uint8_t *> _free_decode_blocks;
+    uint32_t _decode_blocks_used;
+
+    /** \brief A block reused to decode the whole data of static audio
+    *** It is released after decoding data larger than STATIC_DECODE_BLOCK_MAX_KEPT_SIZE,
+    *** so that a single long sound doesn't keep its size allocated.
+    **/
+    std::vector<uint8_t> _static_decode_block;
+
+    //! \brief The audio telemetry of the current period, and of the last finished one
+    private_audio::AudioTelemetry _telemetry;
+    private_audio::AudioTelemetry _last_telemetry;
+
+    //! \brief The time the current telemetry period started, and the time of the last update, in milliseconds
+    uint32_t _telemetry_start_time;
+    uint32_t _last_update_time;
+
+    //! \brief The text displaying the last telemetry summary in the debug overlay
+    vt_video::TextImage *_telemetry_text;
+
     /** \brief The maximum number of entries that are allowed within the audio cache
     *** The default size is set to 1/4th of _max_sources
     **/
@@ -417,6 +632,54 @@ private:
     **/
     bool _LoadAudio(const std::string &filename, bool is_music, vt_mode_manager::GameMode *gm = nullptr);
 
+    /** \brief Gets a reference on the shared static buffer of the given file
+    *** \param filename The name of the audio file to decode, when not already done
+    *** \return The shared buffer, or nullptr if the file couldn't be decoded
+    *** \note Every successful call must be balanced by a call to _ReleaseStaticBuffer().
+    **/
+    private_audio::StaticAudioBuffer *_AcquireStaticBuffer(const std::string &filename);
+
+    //! \brief Removes a reference on a shared static buffer, deleting it when it isn't used anymore
+    void _ReleaseStaticBuffer(private_audio::StaticAudioBuffer *static_buffer);
+
+    //! \brief Releases the static audio decode block when it grew larger than STATIC_DECODE_BLOCK_MAX_KEPT_SIZE.
+    void _TrimStaticDecodeBlock();
+
+    //! \brief Returns an OpenAL buffer name from the pool, or a newly generated one if the pool is empty
+    ALuint _AcquireBufferName();
+
+    //! \brief Gives an OpenAL buffer name back to the pool, deleting it when the pool is full
+    void _ReleaseBufferName(ALuint buffer_name);
+
+    /** \brief Returns a decode block from the pool
+    *** \param size The size needed in bytes. Blocks bigger than AUDIO_DECODE_BLOCK_SIZE are allocated outside of the pool.
+    **/
+    uint8_t *_AcquireDecodeBlock(uint32_t size);
+
+    //! \brief Gives a decode block back, along with the size requested when acquiring it
+    void _ReleaseDecodeBlock(uint8_t *block, uint32_t size);
+
+    /** \brief Updates the telemetry of the current period, and summarizes it when the period is over
+    *** The summary is logged when underruns occurred or when audio debugging is enabled.
+    **/
+    void _UpdateTelemetry();
+
+    /** \brief Computes the buses gains, and applies them to the sources of the buses which gain changed
+    *** \param update_time The time elapsed since the last computation in ms, used by ducking.
+    **/
+    void _UpdateBusGains(uint32_t update_time);
+
+    //! \brief Returns the gain of the given bus, as last computed
+    float _GetBusGain(AUDIO_BUS bus) const {
+        return _buses[bus].gain;
+    }
+
+    //! \brief Tells whether pausing the given ancestor bus pauses the bus
+    bool _IsBusInTree(AUDIO_BUS bus, AUDIO_BUS ancestor) const;
+
+    //! \brief Returns the telemetry summary text of the last period, with the fill level of every playing stream
+    std::string _GetTelemetrySummary() const;
+
 }; // class AudioEngine : public vt_utils::Singleton<AudioEngine>
 
 } // namespace vt_audio
@@ -43,25 +43,14 @@ namespace private_audio
 ////////////////////////////////////////////////////////////////////////////////
 
 AudioBuffer::AudioBuffer() :
-    buffer(0)
+    buffer(AudioManager->_AcquireBufferName())
 {
-    if(AudioManager->CheckALError()) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "OpenAL error detected before buffer generation: " << AudioManager->CreateALErrorString() << std::endl;
-    }
-
-    alGenBuffers(1, &buffer);
-
-    if(AudioManager->CheckALError()) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "OpenAL error detected after buffer generation: "
-                                      << AudioManager->CreateALErrorString() << std::endl;
-        buffer = 0;
-    }
 }
 
 AudioBuffer::~AudioBuffer()
 {
     if(IsValid()) {
-        alDeleteBuffers(1, &buffer);
+        AudioManager->_ReleaseBufferName(buffer);
     }
 }
 
@@ -99,6 +88,36 @@ void AudioSource::Reset()
     }
 }
 
+AudioInput *CreateAudioInput(const std::string &filename)
+{
+    // Name of file is at least 3 letters (so the extension is in there)
+    if(filename.size() <= 3) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "file name argument is too short: " << filename << std::endl;
+        return nullptr;
+    }
+    // Convert the file extension to uppercase and use it to create the proper input type
+    std::string file_extension = filename.substr(filename.size() - 3, 3);
+    file_extension = vt_utils::Upcase(file_extension);
+
+    // Based on the extension of the file, load properly one
+    if(file_extension.compare("WAV") == 0)
+        return new WavFile(filename);
+    else if(file_extension.compare("OGG") == 0)
+        return new OggFile(filename);
+
+    IF_PRINT_WARNING(AUDIO_DEBUG) << "failed due to unsupported input file extension: " << file_extension << std::endl;
+    return nullptr;
+}
+
+ALenum GetAudioInputFormat(const AudioInput *input)
+{
+    if(input->GetBitsPerSample() == 8)
+        return (input->GetNumberChannels() == 1) ? AL_FORMAT_MONO8 : AL_FORMAT_STEREO8;
+
+    // 16 bits per sample
+    return (input->GetNumberChannels() == 1) ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+}
+
 } // namespace private_audio
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -108,16 +127,21 @@ void AudioSource::Reset()
 AudioDescriptor::AudioDescriptor() :
     _state(AUDIO_STATE_UNLOADED),
     _buffer(nullptr),
+    _static_buffer(nullptr),
     _source(nullptr),
     _input(nullptr),
     _stream(nullptr),
     _data(nullptr),
+    _lowest_buffer_fill(NUMBER_STREAMING_BUFFERS),
     _looping(false),
     _offset(0),
+    _queue_start_sample(0),
     _volume(1.0f),
     _fade_effect_time(0.0f),
     _original_volume(0.0f),
-    _stream_buffer_size(0)
+    _stream_buffer_size(0),
+    _bus(AUDIO_BUS_SFX),
+    _paused_by_bus(false)
 {
     _position[0] = 0.0f;
     _position[1] = 0.0f;
@@ -133,16 +157,21 @@ AudioDescriptor::AudioDescriptor() :
 AudioDescriptor::AudioDescriptor(const AudioDescriptor &copy) :
     _state(AUDIO_STATE_UNLOADED),
     _buffer(nullptr),
+    _static_buffer(nullptr),
     _source(nullptr),
     _input(nullptr),
     _stream(nullptr),
     _data(nullptr),
+    _lowest_buffer_fill(NUMBER_STREAMING_BUFFERS),
     _looping(copy._looping),
     _offset(0),
+    _queue_start_sample(0),
     _volume(copy._volume),
     _fade_effect_time(copy._fade_effect_time),
     _original_volume(copy._original_volume),
-    _stream_buffer_size(0)
+    _stream_buffer_size(0),
+    _bus(copy._bus),
+    _paused_by_bus(false)
 {
     _position[0] = 0.0f;
     _position[1] = 0.0f;
@@ -168,24 +197,30 @@ bool AudioDescriptor::LoadAudio(const std::string &filename, AUDIO_LOAD load_typ
     // Clean out any audio resources being used before trying to set new ones
     FreeAudio();
 
-    // Load the input file for the audio
-    if(filename.size() <= 3) {  // Name of file is at least 3 letters (so the extension is in there)
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "file name argument is too short: " << filename << std::endl;
-        return false;
+    // Static audio shares one buffer per file, decoded only once by the audio engine
+    if(load_type == AUDIO_LOAD_STATIC) {
+        _static_buffer = AudioManager->_AcquireStaticBuffer(filename);
+        if(_static_buffer == nullptr)
+            return false;
+
+        _buffer = &_static_buffer->buffer;
+        _input = _static_buffer->input;
+        _format = _static_buffer->format;
+
+        // Attempt to acquire a source for the new audio to use
+        _AcquireSource();
+        if(_source == nullptr) {
+            IF_PRINT_WARNING(AUDIO_DEBUG) << "could not acquire audio source for new audio file: " << filename << std::endl;
+        }
+
+        _state = AUDIO_STATE_STOPPED;
+        return true;
     }
-    // Convert the file extension to uppercase and use it to create the proper input type
-    std::string file_extension = filename.substr(filename.size() - 3, 3);
-    file_extension = vt_utils::Upcase(file_extension);
 
-    // Based on the extension of the file, load properly one
-    if(file_extension.compare("WAV") == 0) {
-        _input = new WavFile(filename);
-    } else if(file_extension.compare("OGG") == 0) {
-        _input = new OggFile(filename);
-    } else {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "failed due to unsupported input file extension: " << file_extension << std::endl;
+    // Load the input file for the audio
+    _input = CreateAudioInput(filename);
+    if(_input == nullptr)
         return false;
-    }
 
     if(_input->Initialize() == false) {
         IF_PRINT_WARNING(AUDIO_DEBUG) << "failed to load and initialize audio file: " << filename << std::endl;
@@ -193,53 +228,15 @@ bool AudioDescriptor::LoadAudio(const std::string &filename, AUDIO_LOAD load_typ
     }
 
     // Retreive audio data properties from the newly initialized input
-    if(_input->GetBitsPerSample() == 8) {
-        if(_input->GetNumberChannels() == 1) {
-            _format = AL_FORMAT_MONO8;
-        } else {
-            _format = AL_FORMAT_STEREO8;
-        }
-    } else { // 16 bits per sample
-        if(_input->GetNumberChannels() == 1) {
-            _format = AL_FORMAT_MONO16;
-        } else {
-            _format = AL_FORMAT_STEREO16;
-        }
-    }
-
-    // Load the audio data depending upon the load type requested
-    if(load_type == AUDIO_LOAD_STATIC) {
-        // For static sounds just 1 buffer is needed. We create it as an array here, so that
-        // later we can delete it with a call of delete[], similar to the streaming cases
-        _buffer = new AudioBuffer[1];
-
-        // Create space in memory for the audio data to be read and passed to the OpenAL buffer
-        _data = new uint8_t[_input->GetDataSize()];
-        bool all_data_read = false;
-        if(_input->Read(_data, _input->GetTotalNumberSamples(), all_data_read) != _input->GetTotalNumberSamples()) {
-            IF_PRINT_WARNING(AUDIO_DEBUG) << "failed to read entire audio data stream for file: " << filename << std::endl;
-            return false;
-        }
-
-        // Pass the buffer data to the OpenAL buffer
-        _buffer->FillBuffer(_data, _format, _input->GetDataSize(), _input->GetSamplesPerSecond());
-        delete[] _data;
-        _data = nullptr;
-
-        // Attempt to acquire a source for the new audio to use
-        _AcquireSource();
-        if(_source == nullptr) {
-            IF_PRINT_WARNING(AUDIO_DEBUG) << "could not acquire audio source for new audio file: " << filename << std::endl;
-        }
-    } // if (load_type == AUDIO_LOAD_STATIC)
+    _format = GetAudioInputFormat(_input);
 
     // Stream the audio from the file data
-    else if(load_type == AUDIO_LOAD_STREAM_FILE) {
+    if(load_type == AUDIO_LOAD_STREAM_FILE) {
         _buffer = new AudioBuffer[NUMBER_STREAMING_BUFFERS]; // For streaming we need to use multiple buffers
         _stream = new AudioStream(_input, _looping);
         _stream_buffer_size = stream_buffer_size;
 
-        _data = new uint8_t[_stream_buffer_size * _input->GetSampleSize()];
+        _data = AudioManager->_AcquireDecodeBlock(_stream_buffer_size * _input->GetSampleSize());
 
         // Attempt to acquire a source for the new audio to use
         _AcquireSource();
@@ -254,7 +251,7 @@ bool AudioDescriptor::LoadAudio(const std::string &filename, AUDIO_LOAD load_typ
         _stream = new AudioStream(_input, _looping);
         _stream_buffer_size = stream_buffer_size;
 
-        _data = new uint8_t[_stream_buffer_size * _input->GetSampleSize()];
+        _data = AudioManager->_AcquireDecodeBlock(_stream_buffer_size * _input->GetSampleSize());
 
         // We need to replace the _input member with a AudioMemory class object
         AudioInput *temp_input = _input;
@@ -290,6 +287,8 @@ void AudioDescriptor::FreeAudio()
 
     _state = AUDIO_STATE_UNLOADED;
     _offset = 0;
+    _queue_start_sample = 0;
+    _paused_by_bus = false;
 
     // If the source is still attached to a sound, reset to the default parameters the source
     if(_source != nullptr) {
@@ -297,11 +296,25 @@ void AudioDescriptor::FreeAudio()
         _source = nullptr;
     }
 
+    // The shared static buffer owns both the buffer and the input
+    if(_static_buffer != nullptr) {
+        AudioManager->_ReleaseStaticBuffer(_static_buffer);
+        _static_buffer = nullptr;
+        _buffer = nullptr;
+        _input = nullptr;
+    }
+
     if(_buffer != nullptr) {
         delete[] _buffer;
         _buffer = nullptr;
     }
 
+    // The decode block size depends on the input, so give it back first.
+    if(_data != nullptr) {
+        AudioManager->_ReleaseDecodeBlock(_data, _stream_buffer_size * _input->GetSampleSize());
+        _data = nullptr;
+    }
+
     if(_input != nullptr) {
         delete _input;
         _input = nullptr;
@@ -311,11 +324,6 @@ void AudioDescriptor::FreeAudio()
         delete _stream;
         _stream = nullptr;
     }
-
-    if(_data != nullptr) {
-        delete[] _data;
-        _data = nullptr;
-    }
 }
 
 bool AudioDescriptor::Play()
@@ -340,6 +348,13 @@ bool AudioDescriptor::Play()
         _PrepareStreamingBuffers();
     }
 
+    // Audio started on a paused bus waits for the bus to be resumed.
+    if(AudioManager->IsBusPaused(_bus)) {
+        _state = AUDIO_STATE_PAUSED;
+        _paused_by_bus = true;
+        return true;
+    }
+
     // Temp: Checks if there is already an AL error in the buffer. If it is, print error and clear buffer.
     if(AudioManager->CheckALError()) {
         IF_PRINT_WARNING(AUDIO_DEBUG) << "audio error occured some time before playing source: " << AudioManager->CreateALErrorString() << std::endl;
@@ -373,6 +388,7 @@ void AudioDescriptor::Stop()
         IF_PRINT_WARNING(AUDIO_DEBUG) << "stopping the source failed: " << AudioManager->CreateALErrorString() << std::endl;
     }
     _state = AUDIO_STATE_STOPPED;
+    _paused_by_bus = false;
 }
 
 
@@ -642,7 +658,8 @@ void AudioDescriptor::FadeIn(float time)
     if(_state != AUDIO_STATE_PLAYING)
         Play();
 
-    if (GetVolume() >= 1.0f)
+    // Audio paused along with its bus can't fade in until the bus is resumed.
+    if (_state != AUDIO_STATE_PLAYING || GetVolume() >= 1.0f)
         return;
 
     _state = AUDIO_STATE_FADE_IN;
@@ -723,6 +740,28 @@ void AudioDescriptor::DEBUG_PrintInfo()
 
 
 
+void AudioDescriptor::SetBus(AUDIO_BUS bus)
+{
+    if(bus >= AUDIO_BUS_TOTAL) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "invalid bus: " << bus << std::endl;
+        return;
+    }
+
+    _bus = bus;
+    _UpdateSourceGain();
+}
+
+void AudioDescriptor::_UpdateSourceGain()
+{
+    if(_source == nullptr)
+        return;
+
+    alSourcef(_source->source, AL_GAIN, _volume * AudioManager->_GetBusGain(_bus));
+    if(AudioManager->CheckALError()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "changing volume on a source failed: " << AudioManager->CreateALErrorString() << std::endl;
+    }
+}
+
 void AudioDescriptor::_SetVolumeControl(float volume)
 {
     if(volume < 0.0f) {
@@ -756,6 +795,9 @@ void AudioDescriptor::_Update()
             IF_PRINT_WARNING(AUDIO_DEBUG) << "getting the source's state failed: " << AudioManager->CreateALErrorString() << std::endl;
         }
         if(source_state != AL_PLAYING) {
+            // A stream source running dry before the end of its data is an underrun.
+            if(_stream && source_state == AL_STOPPED && !_stream->GetEndOfStream())
+                ++AudioManager->_telemetry.underrun_count;
             _state = AUDIO_STATE_STOPPED;
         }
     }
@@ -798,15 +840,32 @@ void AudioDescriptor::_Update()
         IF_PRINT_WARNING(AUDIO_DEBUG) << "getting processed sources failed: " << AudioManager->CreateALErrorString() << std::endl;
     }
 
+    // Keep track of the buffers still waiting to be played
+    uint32_t buffer_fill = (queued > buffers_processed) ? static_cast<uint32_t>(queued - buffers_processed) : 0;
+    if(buffer_fill < _lowest_buffer_fill)
+        _lowest_buffer_fill = buffer_fill;
+    if(buffer_fill < AudioManager->_telemetry.lowest_buffer_fill)
+        AudioManager->_telemetry.lowest_buffer_fill = buffer_fill;
+
     // If any buffers have finished playing, attempt to refill them
     if(buffers_processed > 0) {
+        uint64_t refill_start_time = AudioTelemetry::GetTime();
         ALuint buffer_finished;
         alSourceUnqueueBuffers(_source->source, 1, &buffer_finished);
         if(AudioManager->CheckALError()) {
             IF_PRINT_WARNING(AUDIO_DEBUG) << "unqueuing a source failed: " << AudioManager->CreateALErrorString() << std::endl;
         }
+        else {
+            // The queue now starts after the samples of that buffer.
+            ALint buffer_size = 0;
+            alGetBufferi(buffer_finished, AL_SIZE, &buffer_size);
+            if(buffer_size > 0)
+                _queue_start_sample += static_cast<uint32_t>(buffer_size) / _input->GetSampleSize();
+        }
 
+        uint64_t decode_start_time = AudioTelemetry::GetTime();
         uint32_t size = _stream->FillBuffer(_data, _stream_buffer_size);
+        uint32_t decode_time = AudioTelemetry::GetElapsedTime(decode_start_time);
         if(size > 0) {  // Make sure that there is data available to fill
             alBufferData(buffer_finished, _format, _data, size * _input->GetSampleSize(), _input->GetSamplesPerSecond());
             if(AudioManager->CheckALError()) {
@@ -828,6 +887,8 @@ void AudioDescriptor::_Update()
                 IF_PRINT_WARNING(AUDIO_DEBUG) << "playing a source failed: " << AudioManager->CreateALErrorString() << std::endl;
             }
         }
+
+        AudioManager->_telemetry.AddRefill(AudioTelemetry::GetElapsedTime(refill_start_time), decode_time);
     }
 } // void AudioDescriptor::_Update()
 
@@ -918,16 +979,7 @@ void AudioDescriptor::_SetSourceProperties()
     }
 
     // Set volume (gain)
-    float volume_multiplier = 0.0f;
-    if(IsSound())
-        volume_multiplier = AudioManager->GetSoundVolume();
-    else
-        volume_multiplier = AudioManager->GetMusicVolume();
-
-    alSourcef(_source->source, AL_GAIN, _volume * volume_multiplier);
-    if(AudioManager->CheckALError()) {
-        IF_PRINT_WARNING(AUDIO_DEBUG) << "changing volume on a source failed: " << AudioManager->CreateALErrorString() << std::endl;
-    }
+    _UpdateSourceGain();
 
     // Set looping (source has looping disabled by default, so only need to check the true case)
     if(_stream != nullptr) {
@@ -969,6 +1021,7 @@ void AudioDescriptor::_PrepareStreamingBuffers()
         Stop();
     }
     alSourcei(_source->source, AL_BUFFER, 0);
+    _queue_start_sample = _stream->GetCurrentSamplePosition();
 
     // Fill each buffer with audio data
     for(uint32_t i = 0; i < NUMBER_STREAMING_BUFFERS; i++) {
@@ -1023,12 +1076,7 @@ SoundDescriptor::SoundDescriptor(const SoundDescriptor &copy) :
 void SoundDescriptor::SetVolume(float volume)
 {
     AudioDescriptor::_SetVolumeControl(volume);
-
-    float sound_volume = _volume * AudioManager->GetSoundVolume();
-
-    if(_source) {
-        alSourcef(_source->source, AL_GAIN, sound_volume);
-    }
+    _UpdateSourceGain();
 }
 
 bool SoundDescriptor::Play()
@@ -1050,6 +1098,7 @@ MusicDescriptor::MusicDescriptor() :
     AudioDescriptor()
 {
     _looping = true;
+    _bus = AUDIO_BUS_MUSIC;
     AudioManager->_registered_music.push_back(this);
 }
 
@@ -1106,12 +1155,7 @@ bool MusicDescriptor::Play()
 void MusicDescriptor::SetVolume(float volume)
 {
     AudioDescriptor::_SetVolumeControl(volume);
-
-    float music_volume = _volume * AudioManager->GetMusicVolume();
-
-    if(_source) {
-        alSourcef(_source->source, AL_GAIN, (ALfloat)music_volume);
-    }
+    _UpdateSourceGain();
 }
 
 } // namespace vt_audio
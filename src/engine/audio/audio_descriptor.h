@@ -36,6 +36,7 @@ namespace vt_audio
 {
 
 class AudioDescriptor;
+class LayeredMusic;
 
 //! \brief The set of states that AudioDescriptor class objects may be in
 enum AUDIO_STATE {
@@ -63,6 +64,21 @@ enum AUDIO_LOAD {
     AUDIO_LOAD_STREAM_MEMORY  = 2
 };
 
+/** \brief The mixing buses audio descriptors are attached to
+*** The buses form a tree: The master bus is the root, the music and sfx buses are its
+*** children, while the ambience, ui and voice buses are children of the sfx bus.
+*** \note Parent buses must be listed before their children.
+**/
+enum AUDIO_BUS {
+    AUDIO_BUS_MASTER   = 0,
+    AUDIO_BUS_MUSIC    = 1,
+    AUDIO_BUS_SFX      = 2,
+    AUDIO_BUS_AMBIENCE = 3,
+    AUDIO_BUS_UI       = 4,
+    AUDIO_BUS_VOICE    = 5,
+    AUDIO_BUS_TOTAL    = 6
+};
+
 namespace private_audio
 {
 
@@ -74,12 +90,23 @@ const uint32_t DEFAULT_BUFFER_SIZE = 8192;
 //! \brief The number of buffers to use for streaming audio descriptors
 const uint32_t NUMBER_STREAMING_BUFFERS = 4;
 
+/** \brief The size in bytes of the pooled decode blocks used by streaming audio descriptors
+*** It holds a default sized stream buffer of 16 bits stereo samples, the largest sample size.
+**/
+const uint32_t AUDIO_DECODE_BLOCK_SIZE = DEFAULT_BUFFER_SIZE * 4;
+
+//! \brief The largest size in bytes of the static audio decode block kept between two static audio loads
+const uint32_t STATIC_DECODE_BLOCK_MAX_KEPT_SIZE = 256 * 1024;
+
 /** ****************************************************************************
 *** \brief Represents an OpenAL buffer
 ***
 *** A buffer in OpenAL is simply a structure which contains raw audio data.
 *** Buffers must be attached to an OpenAL source in order to play. OpenAL
 *** suppports an infinte number of buffers (as long as there is enough memory).
+***
+*** \note The OpenAL buffer names are borrowed from the pool of the AudioEngine
+*** class and returned to it on destruction, rather than generated and deleted.
 *** ***************************************************************************/
 class AudioBuffer
 {
@@ -170,6 +197,52 @@ public:
     AudioDescriptor *owner;
 }; // class AudioSource
 
+
+/** ****************************************************************************
+*** \brief An OpenAL buffer holding the whole data of a statically loaded file
+***
+*** Static sounds referring to the same file all play the same buffer, which is
+*** decoded and uploaded only once. These buffers are created and reference
+*** counted by the AudioEngine class, while the audio descriptors using them
+*** only keep their own source, volume and looping properties.
+***
+*** \note The buffer is deleted only once no descriptor refers to it anymore,
+*** since OpenAL can't delete a buffer still attached to a source.
+*** ***************************************************************************/
+class StaticAudioBuffer
+{
+public:
+    StaticAudioBuffer() :
+        input(nullptr),
+        format(AL_FORMAT_MONO8),
+        reference_count(0) {}
+
+    ~StaticAudioBuffer() {
+        delete input;
+    }
+
+    //! \brief The OpenAL buffer containing the whole audio data
+    AudioBuffer buffer;
+
+    //! \brief The input the data was decoded from, kept for its properties (filename, samples count, ...)
+    AudioInput *input;
+
+    //! \brief The format of the audio (mono/stereo, 8/16 bits per second).
+    ALenum format;
+
+    //! \brief The number of audio descriptors using the buffer
+    uint32_t reference_count;
+}; // class StaticAudioBuffer
+
+/** \brief Creates the audio input corresponding to the file extension
+*** \param filename The name of the .wav or .ogg file to read
+*** \return The uninitialized input, or nullptr if the file extension isn't supported
+**/
+AudioInput *CreateAudioInput(const std::string &filename);
+
+//! \brief Returns the OpenAL format matching the given initialized input properties
+ALenum GetAudioInputFormat(const AudioInput *input);
+
 } // namespace private_audio
 
 /** ****************************************************************************
@@ -194,6 +267,7 @@ public:
 class AudioDescriptor
 {
     friend class AudioEngine;
+    friend class LayeredMusic;
 
 public:
     AudioDescriptor();
@@ -218,6 +292,7 @@ public:
     /** \brief Frees all data resources and resets class parameters
     ***
     *** It resets the _state and _offset class members, as well as deleting _data, _stream, _input, _buffer, and resets _source.
+    *** Shared static buffers are released instead of being deleted.
     **/
     void FreeAudio();
 
@@ -298,6 +373,16 @@ public:
     **/
     virtual void SetVolume(float volume) = 0;
 
+    //! \brief Returns the mixing bus the audio is attached to
+    AUDIO_BUS GetBus() const {
+        return _bus;
+    }
+
+    /** \brief Attaches the audio to another mixing bus
+    *** The audio gain is the product of its own volume and of the gains of its bus and the bus parents.
+    **/
+    void SetBus(AUDIO_BUS bus);
+
     /** \name Functions for 3D Spatial Audio
     *** These functions manipulate and retrieve the 3d properties of the audio. Note that only audio which
     *** are mono channel will be affected by these methods. Stereo channel audio will see no difference.
@@ -376,6 +461,11 @@ protected:
     //! \brief A pointer to the buffer(s) being used by the audio (1 buffer for static sounds, 2 for streamed ones)
     private_audio::AudioBuffer *_buffer;
 
+    /** \brief The shared buffer of statically loaded audio, or nullptr when streamed
+    *** When set, _buffer and _input point into it and aren't owned by the descriptor.
+    **/
+    private_audio::StaticAudioBuffer *_static_buffer;
+
     //! \brief A pointer to the source object being used by the audio
     private_audio::AudioSource *_source;
 
@@ -388,6 +478,9 @@ protected:
     //! \brief A pointer to where the data is streamed to
     uint8_t *_data;
 
+    //! \brief The lowest number of streaming buffers queued for playback during the current telemetry period
+    uint32_t _lowest_buffer_fill;
+
     //! \brief The format of the audio (mono/stereo, 8/16 bits per second).
     ALenum _format;
 
@@ -397,6 +490,12 @@ protected:
     //! \brief The audio position that was last seeked, in samples.
     uint32_t _offset;
 
+    /** \brief The stream position of the first sample queued on the source, in samples.
+    *** Adding the source AL_SAMPLE_OFFSET gives the position being played. It keeps growing
+    *** when the stream loops, and is only valid for streamed audio.
+    **/
+    uint32_t _queue_start_sample;
+
     /** \brief The volume of the audio, ranging from 0.0f to 1.0f
     *** This isn't actually the true volume of the audio, but rather the modulation
     *** value of the global sound or music volume level. For example, if this object
@@ -434,11 +533,20 @@ protected:
     //! \brief Holds all active audio effects for this descriptor
     std::vector<private_audio::AudioEffect *> _audio_effects;
 
+    //! \brief The mixing bus the audio is attached to
+    AUDIO_BUS _bus;
+
+    //! \brief Set when the audio was paused because of its bus, to resume it along with the bus
+    bool _paused_by_bus;
+
+    //! \brief Applies the audio volume modulated by its bus gain to the source, if any
+    void _UpdateSourceGain();
+
     /** \brief Sets the local volume control for this particular audio piece
     *** \param volume The volume level to set, ranging from [0.0f, 1.0f]
     *** This should be thought of as a helper function to the SetVolume methods
     *** for the derived classes, which modulate the volume level of the sound/music
-    *** by the global sound and music volume controls in the AudioEngine class.
+    *** by the gain of the mixing bus they are attached to.
     **/
     void _SetVolumeControl(float volume);
 
@@ -25,6 +25,9 @@
 #include "utils/utils_pch.h"
 #include "audio_input.h"
 
+#include "utils/utils_files.h"
+#include "utils/utils_strings.h"
+
 namespace vt_audio
 {
 
@@ -68,7 +71,7 @@ bool WavFile::Initialize()
 
     char buffer[4];
 
-    _file_input.open(_filename.c_str(), std::ios::binary);
+    _file_input.open(_data_filename.c_str(), std::ios::binary);
     if(_file_input.fail()) {
         _file_input.clear();
         return false;
@@ -465,6 +468,128 @@ uint32_t AudioMemory::Read(uint8_t *buffer, uint32_t size, bool &end)
     return read;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// PCM cache functions
+////////////////////////////////////////////////////////////////////////////////
+
+//! \brief The directory of the PCM cache, relative to the user data path
+static const std::string PCM_CACHE_DIRECTORY = "pcm_cache/";
+
+/** \brief Returns the start of the PCM cache filenames of an audio file
+*** The whole path is hashed, so that distinct paths never share their cache files
+*** the way they could when flattening the path separators.
+**/
+static std::string _GetPcmCachePrefix(const std::string &filename)
+{
+    // 64-bit FNV-1a hash
+    uint64_t hash = 14695981039346656037ULL;
+    for(uint32_t i = 0; i < filename.size(); ++i) {
+        hash ^= static_cast<uint8_t>(filename[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    static const char hex_digits[] = "0123456789abcdef";
+    std::string prefix(16, '0');
+    for(uint32_t i = 0; i < 16; ++i)
+        prefix[15 - i] = hex_digits[(hash >> (4 * i)) & 0xF];
+    return prefix + "_";
+}
+
+//! \brief Writes a value in little endian order, as expected in wav files
+static void _WriteLittleEndian(std::ofstream &file, uint32_t value, uint32_t number_bytes)
+{
+    for(uint32_t i = 0; i < number_bytes; ++i) {
+        char byte = static_cast<char>((value >> (8 * i)) & 0xFF);
+        file.write(&byte, 1);
+    }
+}
+
+std::string GetPcmCacheFilename(const std::string &filename)
+{
+    if(filename.size() <= 3)
+        return std::string();
+
+    // Only Ogg files are worth caching, since wav files are already raw data
+    std::string file_extension = vt_utils::Upcase(filename.substr(filename.size() - 3, 3));
+    if(file_extension.compare("OGG") != 0)
+        return std::string();
+
+    uint32_t mod_time = vt_utils::GetFileModTime(filename);
+    if(mod_time == 0)
+        return std::string();
+
+    return vt_utils::GetUserDataPath() + PCM_CACHE_DIRECTORY + _GetPcmCachePrefix(filename)
+           + vt_utils::NumberToString(mod_time) + ".wav";
+}
+
+bool WritePcmCacheFile(const std::string &cache_filename, const AudioInput *input, const uint8_t *data)
+{
+    if(input->GetDataSize() > PCM_CACHE_MAX_DATA_SIZE)
+        return false;
+
+    const std::string cache_directory = vt_utils::GetUserDataPath() + PCM_CACHE_DIRECTORY;
+    if(!vt_utils::DoesFileExist(cache_directory) && !vt_utils::MakeDirectory(cache_directory)) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "could not create the PCM cache directory: " << cache_directory << std::endl;
+        return false;
+    }
+
+    // Write in a temporary file first, so that an interrupted write never leaves a truncated cache file
+    const std::string temp_filename = cache_filename + ".tmp";
+    std::ofstream file(temp_filename.c_str(), std::ios::binary);
+    if(file.fail()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "could not open PCM cache file for writing: " << temp_filename << std::endl;
+        return false;
+    }
+
+    // The header expected by WavFile::Initialize()
+    file.write("RIFF", 4);
+    _WriteLittleEndian(file, 36 + input->GetDataSize(), 4);
+    file.write("WAVE", 4);
+    file.write("fmt ", 4);
+    _WriteLittleEndian(file, 16, 4);
+    _WriteLittleEndian(file, 1, 2); // PCM
+    _WriteLittleEndian(file, input->GetNumberChannels(), 2);
+    _WriteLittleEndian(file, input->GetSamplesPerSecond(), 4);
+    _WriteLittleEndian(file, input->GetSamplesPerSecond() * input->GetSampleSize(), 4);
+    _WriteLittleEndian(file, input->GetSampleSize(), 2);
+    _WriteLittleEndian(file, input->GetBitsPerSample(), 2);
+    file.write("data", 4);
+    _WriteLittleEndian(file, input->GetDataSize(), 4);
+
+#ifdef __BIG_ENDIAN__
+    if(input->GetBitsPerSample() == 16) {
+        for(uint32_t i = 0; i + 1 < input->GetDataSize(); i += 2) {
+            file.write(reinterpret_cast<const char *>(data + i + 1), 1);
+            file.write(reinterpret_cast<const char *>(data + i), 1);
+        }
+    }
+    else {
+        file.write(reinterpret_cast<const char *>(data), input->GetDataSize());
+    }
+#else
+    file.write(reinterpret_cast<const char *>(data), input->GetDataSize());
+#endif
+
+    bool success = !file.fail();
+    file.close();
+
+    if(!success || !vt_utils::MoveFile(temp_filename, cache_filename)) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "failed to write PCM cache file: " << cache_filename << std::endl;
+        vt_utils::DeleteFile(temp_filename);
+        return false;
+    }
+
+    // Remove the cache files written before the audio file was last modified.
+    const std::string cache_name = cache_filename.substr(cache_directory.size());
+    const std::string prefix = cache_name.substr(0, cache_name.find('_') + 1);
+    std::vector<std::string> cache_files = vt_utils::ListDirectory(cache_directory, prefix);
+    for(uint32_t i = 0; i < cache_files.size(); ++i) {
+        if(cache_files[i] != cache_name && cache_files[i].compare(0, prefix.size(), prefix) == 0)
+            vt_utils::DeleteFile(cache_directory + cache_files[i]);
+    }
+    return true;
+}
+
 } // namespace private_audio
 
 } // namespace vt_audio
@@ -148,7 +148,18 @@ class WavFile : public AudioInput
 {
 public:
     explicit WavFile(const std::string& file_name) :
-        AudioInput() {
+        AudioInput(),
+        _data_filename(file_name) {
+        _filename = file_name;
+    }
+
+    /** \brief Reads the data of another wav file, while reporting the given filename
+    *** \param file_name The filename returned by GetFilename()
+    *** \param data_file_name The wav file actually read, such as a PCM cache file
+    **/
+    WavFile(const std::string& file_name, const std::string& data_file_name) :
+        AudioInput(),
+        _data_filename(data_file_name) {
         _filename = file_name;
     }
 
@@ -166,6 +177,9 @@ public:
     //@}
 
 private:
+    //! \brief The name of the wav file read, which may differ from the reported filename
+    std::string _data_filename;
+
     //! \brief The input I/O stream for the file
     std::ifstream _file_input;
 
@@ -283,6 +297,29 @@ private:
     uint32_t _data_position;
 }; // class AudioMemory : public AudioInput
 
+//! \brief The maximum size in bytes of the decoded data of an Ogg file stored in the PCM cache
+const uint32_t PCM_CACHE_MAX_DATA_SIZE = 1024 * 1024;
+
+/** \brief Returns the PCM cache file corresponding to the given Ogg file
+*** \param filename The name of the Ogg file
+*** \return The cache filename, or an empty string if the file can't be cached
+***
+*** The PCM cache stores the decoded data of short Ogg files as wav files in the user data
+*** directory, so that they don't have to be decoded again each time they are loaded.
+*** The cache filename depends on both a hash of the file path and its modification time,
+*** so that editing the original file invalidates its cached data.
+**/
+std::string GetPcmCacheFilename(const std::string &filename);
+
+/** \brief Writes decoded audio data into the PCM cache
+*** \param cache_filename The file to write, as given by GetPcmCacheFilename()
+*** \param input The initialized input the data was decoded from
+*** \param data The whole decoded data, of input->GetDataSize() bytes
+*** \return True if the file was successfully written
+*** The cache files of older versions of the same audio file are removed.
+**/
+bool WritePcmCacheFile(const std::string &cache_filename, const AudioInput *input, const uint8_t *data);
+
 } // namespace private_audio
 
 } // namespace vt_audio
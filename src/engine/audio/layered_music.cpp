@@ -0,0 +1,509 @@
+////////////////////////////////////////////////////////////////////////////////
+//            Copyright (C) 2012-2016 by Bertram (Valyria Tear)
+//                         All Rights Reserved
+//
+// This code is licensed under the GNU GPL version 2. It is free software
+// and you may modify it and/or redistribute it under the terms of this license.
+// See http://www.gnu.org/copyleft/gpl.html for details.
+////////////////////////////////////////////////////////////////////////////////
+
+/** ****************************************************************************
+*** \file   layered_music.cpp
+*** \author Valyria Tear team, https://github.com/ValyriaTear/ValyriaTear/issues
+*** \brief  Source file for layered music
+*** ***************************************************************************/
+
+#include "utils/utils_pch.h"
+#include "layered_music.h"
+
+#include "audio.h"
+
+#include "engine/script/script_read.h"
+#include "engine/system.h"
+
+using namespace vt_system;
+using namespace vt_audio::private_audio;
+
+namespace vt_audio
+{
+
+namespace private_audio
+{
+
+MusicLayer::MusicLayer() :
+    AudioDescriptor(),
+    target_volume(1.0f),
+    fade_speed(0.0f)
+{
+    _looping = true;
+    _bus = AUDIO_BUS_MUSIC;
+}
+
+void MusicLayer::SetVolume(float volume)
+{
+    AudioDescriptor::_SetVolumeControl(volume);
+    _UpdateSourceGain();
+}
+
+} // namespace private_audio
+
+LayeredMusic::LayeredMusic() :
+    _beats_per_minute(0.0f),
+    _beats_per_bar(4),
+    _first_beat_time(0),
+    _play_time(0),
+    _play_samples(0),
+    _last_master_sample(0),
+    _track_length(0),
+    _playing(false)
+{
+    AudioManager->_registered_layered_music.push_back(this);
+}
+
+LayeredMusic::~LayeredMusic()
+{
+    FreeLayers();
+
+    for(std::vector<LayeredMusic *>::iterator it = AudioManager->_registered_layered_music.begin();
+            it != AudioManager->_registered_layered_music.end(); ++it) {
+        if(*it == this) {
+            AudioManager->_registered_layered_music.erase(it);
+            return;
+        }
+    }
+}
+
+bool LayeredMusic::LoadLayers(const std::string &script_filename)
+{
+    FreeLayers();
+
+    vt_script::ReadScriptDescriptor music_script;
+    if(!music_script.OpenFile(script_filename)) {
+        PRINT_WARNING << "Couldn't open the layered music file: " << script_filename << std::endl;
+        return false;
+    }
+
+    if(!music_script.OpenTable("layered_music")) {
+        PRINT_WARNING << "No 'layered_music' table in file: " << script_filename << std::endl;
+        music_script.CloseFile();
+        return false;
+    }
+
+    // The tempo is optional: Without it, the volume changes aren't synchronized.
+    uint32_t beats_per_bar = 4;
+    if(music_script.DoesUIntExist("beats_per_bar"))
+        beats_per_bar = music_script.ReadUInt("beats_per_bar");
+    uint32_t first_beat_time = 0;
+    if(music_script.DoesUIntExist("first_beat"))
+        first_beat_time = music_script.ReadUInt("first_beat");
+    float tempo = 0.0f;
+    if(music_script.DoesFloatExist("tempo"))
+        tempo = music_script.ReadFloat("tempo");
+    SetTempo(tempo, beats_per_bar, first_beat_time);
+
+    if(music_script.OpenTable("layers")) {
+        uint32_t layers_size = music_script.GetTableSize();
+        for(uint32_t i = 1; i <= layers_size; ++i) {
+            if(!music_script.OpenTable(i))
+                continue;
+            float volume = 1.0f;
+            if(music_script.DoesFloatExist("volume"))
+                volume = music_script.ReadFloat("volume");
+            AddLayer(music_script.ReadString("file"), volume);
+            music_script.CloseTable(); // layer
+        }
+        music_script.CloseTable(); // layers
+    }
+
+    music_script.CloseTable(); // layered_music
+
+    if(music_script.IsErrorDetected()) {
+        PRINT_WARNING << "Errors while reading the layered music file: " << script_filename << std::endl
+                      << music_script.GetErrorMessages() << std::endl;
+    }
+    music_script.CloseFile();
+
+    if(_layers.empty()) {
+        PRINT_WARNING << "No layer could be loaded from file: " << script_filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool LayeredMusic::AddLayer(const std::string &filename, float volume)
+{
+    if(_playing) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "layers can't be added while the music is playing: " << filename << std::endl;
+        return false;
+    }
+
+    MusicLayer *layer = new MusicLayer();
+    if(!layer->LoadAudio(filename, AUDIO_LOAD_STREAM_FILE)) {
+        PRINT_WARNING << "Couldn't load the music layer: " << filename << std::endl;
+        delete layer;
+        return false;
+    }
+
+    layer->SetVolume(volume);
+    layer->target_volume = layer->GetVolume();
+
+    if(_layers.empty())
+        _track_length = static_cast<uint32_t>(layer->_input->GetPlayTime() * 1000.0f);
+
+    _layers.push_back(layer);
+    return true;
+}
+
+void LayeredMusic::FreeLayers()
+{
+    Stop();
+
+    for(uint32_t i = 0; i < _layers.size(); ++i)
+        delete _layers[i];
+    _layers.clear();
+    _track_length = 0;
+}
+
+void LayeredMusic::SetTempo(float beats_per_minute, uint32_t beats_per_bar, uint32_t first_beat_time)
+{
+    if(beats_per_minute < 0.0f) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "invalid tempo: " << beats_per_minute << std::endl;
+        beats_per_minute = 0.0f;
+    }
+    if(beats_per_bar == 0) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "a bar needs at least one beat" << std::endl;
+        beats_per_bar = 1;
+    }
+
+    _beats_per_minute = beats_per_minute;
+    _beats_per_bar = beats_per_bar;
+    _first_beat_time = first_beat_time;
+}
+
+bool LayeredMusic::Play()
+{
+    if(!AUDIO_ENABLE)
+        return true;
+
+    if(_playing || _layers.empty())
+        return _playing;
+
+    _playing = true;
+    _play_time = 0;
+    _play_samples = 0;
+    _last_master_sample = 0;
+
+    if(!_StartLayers(0)) {
+        Stop();
+        return false;
+    }
+    return true;
+}
+
+bool LayeredMusic::_StartLayers(uint32_t sample)
+{
+    // Every layer gets a source and its first buffers queued from the given sample,
+    // so that they can all be started in one call.
+    std::vector<ALuint> sources;
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        AudioDescriptor *layer = _layers[i];
+        if(!layer->_source)
+            layer->_AcquireSource();
+        if(!layer->_source) {
+            PRINT_WARNING << "No audio source available for the music layer: " << layer->GetFilename() << std::endl;
+            return false;
+        }
+        layer->SeekSample(sample);
+    }
+
+    // A layer source could have been stolen by the next layers when no free source was left.
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        AudioDescriptor *layer = _layers[i];
+        if(!layer->_source || layer->_source->owner != layer) {
+            PRINT_WARNING << "Not enough audio sources to play all the music layers" << std::endl;
+            return false;
+        }
+        sources.push_back(layer->_source->source);
+    }
+
+    // The layers will be resumed along with the music bus.
+    if(AudioManager->IsBusPaused(AUDIO_BUS_MUSIC)) {
+        for(uint32_t i = 0; i < _layers.size(); ++i) {
+            _layers[i]->_state = AUDIO_STATE_PAUSED;
+            _layers[i]->_paused_by_bus = true;
+        }
+        return true;
+    }
+
+    alSourcePlayv(sources.size(), &sources[0]);
+    if(AudioManager->CheckALError()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "playing the layer sources failed: " << AudioManager->CreateALErrorString() << std::endl;
+    }
+    for(uint32_t i = 0; i < _layers.size(); ++i)
+        _layers[i]->_state = AUDIO_STATE_PLAYING;
+
+    return true;
+}
+
+void LayeredMusic::Stop()
+{
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        MusicLayer *layer = _layers[i];
+        layer->Stop();
+        // Pending fades are dropped: Jump to their target volume.
+        if(layer->fade_speed != 0.0f) {
+            layer->SetVolume(layer->target_volume);
+            layer->fade_speed = 0.0f;
+        }
+    }
+
+    _pending_transitions.clear();
+    _playing = false;
+    _play_time = 0;
+    _play_samples = 0;
+    _last_master_sample = 0;
+}
+
+void LayeredMusic::Pause()
+{
+    _PauseLayers(false);
+}
+
+void LayeredMusic::Resume()
+{
+    _ResumeLayers(false);
+}
+
+void LayeredMusic::_PauseLayers(bool by_bus)
+{
+    std::vector<ALuint> sources;
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        AudioDescriptor *layer = _layers[i];
+        if(layer->_source && layer->_state == AUDIO_STATE_PLAYING)
+            sources.push_back(layer->_source->source);
+    }
+    if(sources.empty())
+        return;
+
+    alSourcePausev(sources.size(), &sources[0]);
+    if(AudioManager->CheckALError()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "pausing the layer sources failed: " << AudioManager->CreateALErrorString() << std::endl;
+    }
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        if(_layers[i]->_state == AUDIO_STATE_PLAYING) {
+            _layers[i]->_state = AUDIO_STATE_PAUSED;
+            _layers[i]->_paused_by_bus = by_bus;
+        }
+    }
+}
+
+void LayeredMusic::_ResumeLayers(bool by_bus)
+{
+    bool bus_paused = AudioManager->IsBusPaused(AUDIO_BUS_MUSIC);
+
+    std::vector<ALuint> sources;
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        AudioDescriptor *layer = _layers[i];
+        if(!layer->_source || layer->_state != AUDIO_STATE_PAUSED)
+            continue;
+        // The bus only resumes the layers it paused.
+        if(by_bus && !layer->_paused_by_bus)
+            continue;
+
+        if(bus_paused)
+            layer->_paused_by_bus = true;
+        else
+            sources.push_back(layer->_source->source);
+    }
+    if(sources.empty())
+        return;
+
+    alSourcePlayv(sources.size(), &sources[0]);
+    if(AudioManager->CheckALError()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "resuming the layer sources failed: " << AudioManager->CreateALErrorString() << std::endl;
+    }
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        if(_layers[i]->_state == AUDIO_STATE_PAUSED && (!by_bus || _layers[i]->_paused_by_bus)) {
+            _layers[i]->_state = AUDIO_STATE_PLAYING;
+            _layers[i]->_paused_by_bus = false;
+        }
+    }
+}
+
+float LayeredMusic::GetLayerVolume(uint32_t layer) const
+{
+    if(layer >= _layers.size())
+        return 0.0f;
+    return _layers[layer]->GetVolume();
+}
+
+void LayeredMusic::SetLayerVolume(uint32_t layer, float volume, uint32_t fade_time, MUSIC_SYNC sync)
+{
+    if(layer >= _layers.size()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "invalid layer index: " << layer << std::endl;
+        return;
+    }
+
+    if(volume < 0.0f)
+        volume = 0.0f;
+    else if(volume > 1.0f)
+        volume = 1.0f;
+
+    LayerTransition transition;
+    transition.layer = layer;
+    transition.volume = volume;
+    transition.fade_time = fade_time;
+    transition.start_time = _play_time + GetTimeToNextBoundary(sync);
+
+    // A new change replaces the one still waiting on the same layer.
+    for(std::vector<LayerTransition>::iterator it = _pending_transitions.begin();
+            it != _pending_transitions.end(); ++it) {
+        if(it->layer == layer) {
+            _pending_transitions.erase(it);
+            break;
+        }
+    }
+
+    if(!_playing || transition.start_time == _play_time) {
+        _StartTransition(transition);
+        return;
+    }
+
+    std::vector<LayerTransition>::iterator it = _pending_transitions.begin();
+    while(it != _pending_transitions.end() && it->start_time <= transition.start_time)
+        ++it;
+    _pending_transitions.insert(it, transition);
+}
+
+uint32_t LayeredMusic::GetTimeToNextBoundary(MUSIC_SYNC sync) const
+{
+    if(!_playing || sync == MUSIC_SYNC_IMMEDIATE || _beats_per_minute <= 0.0f)
+        return 0;
+
+    float boundary_length = 60000.0f / _beats_per_minute;
+    if(sync == MUSIC_SYNC_BAR)
+        boundary_length *= _beats_per_bar;
+
+    // The layers loop, so the position is taken within the track.
+    uint32_t track_position = _track_length > 0 ? _play_time % _track_length : _play_time;
+    if(track_position < _first_beat_time)
+        return _first_beat_time - track_position;
+
+    float position = static_cast<float>(track_position - _first_beat_time);
+    float next_boundary = std::ceil(position / boundary_length) * boundary_length;
+    return static_cast<uint32_t>(next_boundary - position + 0.5f);
+}
+
+void LayeredMusic::_Update()
+{
+    if(!_playing || _layers.empty())
+        return;
+
+    // The music clock only runs while the layers are playing, and is stopped by a master stem underrun.
+    MusicLayer *master = _layers[0];
+    if(master->GetState() == AUDIO_STATE_PAUSED || !master->_source)
+        return;
+
+    // The clock follows the samples actually played by the master stem.
+    const uint32_t total_samples = master->_input->GetTotalNumberSamples();
+    const uint32_t samples_per_second = master->_input->GetSamplesPerSecond();
+    uint32_t master_sample = _GetLayerSample(master);
+    if(master_sample >= _last_master_sample)
+        _play_samples += master_sample - _last_master_sample;
+    else // The track looped
+        _play_samples += total_samples - _last_master_sample + master_sample;
+    _last_master_sample = master_sample;
+    _play_time = static_cast<uint32_t>(_play_samples * 1000 / samples_per_second);
+
+    // The layers stopped by an underrun, or drifting away from the master stem, are sought back to it.
+    const uint32_t resync_samples = samples_per_second * MUSIC_LAYER_RESYNC_TIME / 1000;
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        MusicLayer *layer = _layers[i];
+        uint32_t drift = 0;
+        if(i > 0 && layer->_source) {
+            uint32_t layer_sample = _GetLayerSample(layer);
+            drift = (layer_sample > master_sample) ? layer_sample - master_sample : master_sample - layer_sample;
+            // The drift is the shortest way around the track loop.
+            drift = std::min(drift, total_samples - drift);
+        }
+        if(layer->GetState() == AUDIO_STATE_STOPPED || drift > resync_samples) {
+            _Resync(master_sample);
+            break;
+        }
+    }
+    if(!_playing)
+        return;
+
+    uint32_t update_time = SystemManager->GetUpdateTime();
+
+    while(!_pending_transitions.empty() && _pending_transitions.front().start_time <= _play_time) {
+        _StartTransition(_pending_transitions.front());
+        _pending_transitions.erase(_pending_transitions.begin());
+    }
+
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        MusicLayer *layer = _layers[i];
+        if(layer->fade_speed == 0.0f)
+            continue;
+
+        float volume = layer->GetVolume() + layer->fade_speed * update_time;
+        if((layer->fade_speed > 0.0f && volume >= layer->target_volume)
+                || (layer->fade_speed < 0.0f && volume <= layer->target_volume)) {
+            volume = layer->target_volume;
+            layer->fade_speed = 0.0f;
+        }
+        layer->SetVolume(volume);
+    }
+}
+
+uint32_t LayeredMusic::_GetLayerSample(const MusicLayer *layer) const
+{
+    ALint offset = 0;
+    if(layer->_source) {
+        alGetSourcei(layer->_source->source, AL_SAMPLE_OFFSET, &offset);
+        if(AudioManager->CheckALError()) {
+            IF_PRINT_WARNING(AUDIO_DEBUG) << "getting a layer offset failed: " << AudioManager->CreateALErrorString() << std::endl;
+        }
+    }
+
+    uint32_t total_samples = layer->_input->GetTotalNumberSamples();
+    uint32_t sample = layer->_queue_start_sample + static_cast<uint32_t>(std::max(offset, 0));
+    return (total_samples > 0) ? sample % total_samples : sample;
+}
+
+void LayeredMusic::_Resync(uint32_t master_sample)
+{
+    IF_PRINT_WARNING(AUDIO_DEBUG) << "seeking the music layers back to the master stem" << std::endl;
+
+    // The sources may still be playing while their layers are stopped, after an underrun.
+    for(uint32_t i = 0; i < _layers.size(); ++i) {
+        if(_layers[i]->_source)
+            alSourceStop(_layers[i]->_source->source);
+        _layers[i]->_state = AUDIO_STATE_STOPPED;
+    }
+    if(AudioManager->CheckALError()) {
+        IF_PRINT_WARNING(AUDIO_DEBUG) << "stopping the layer sources failed: " << AudioManager->CreateALErrorString() << std::endl;
+    }
+
+    if(!_StartLayers(master_sample)) {
+        Stop();
+        return;
+    }
+    _last_master_sample = master_sample;
+}
+
+void LayeredMusic::_StartTransition(const LayerTransition &transition)
+{
+    MusicLayer *layer = _layers[transition.layer];
+    layer->target_volume = transition.volume;
+
+    if(transition.fade_time == 0 || !_playing) {
+        layer->fade_speed = 0.0f;
+        layer->SetVolume(transition.volume);
+        return;
+    }
+
+    layer->fade_speed = (transition.volume - layer->GetVolume()) / static_cast<float>(transition.fade_time);
+}
+
+} // namespace vt_audio
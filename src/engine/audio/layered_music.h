@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+//            Copyright (C) 2012-2016 by Bertram (Valyria Tear)
+//                         All Rights Reserved
+//
+// This code is licensed under the GNU GPL version 2. It is free software
+// and you may modify it and/or redistribute it under the terms of this license.
+// See http://www.gnu.org/copyleft/gpl.html for details.
+////////////////////////////////////////////////////////////////////////////////
+
+/** ****************************************************************************
+*** \file   layered_music.h
+*** \author Valyria Tear team, https://github.com/ValyriaTear/ValyriaTear/issues
+*** \brief  Header file for layered music
+***
+*** A layered music plays several stems of the same composition together,
+*** starting them at the same time so that they stay sample-aligned. The music
+*** intensity is then changed by adjusting each stem volume, optionally waiting
+*** for the next beat or bar of the composition so that the change stays in rhythm.
+*** ***************************************************************************/
+
+#ifndef __LAYERED_MUSIC_HEADER__
+#define __LAYERED_MUSIC_HEADER__
+
+#include "audio_descriptor.h"
+
+namespace vt_audio
+{
+
+//! \brief The drift from the master stem, in milliseconds, over which the layers are sought back to it.
+const uint32_t MUSIC_LAYER_RESYNC_TIME = 30;
+
+//! \brief The musical boundaries a layer volume change can be synchronized on
+enum MUSIC_SYNC {
+    MUSIC_SYNC_IMMEDIATE = 0,
+    MUSIC_SYNC_BEAT = 1,
+    MUSIC_SYNC_BAR = 2
+};
+
+namespace private_audio
+{
+
+/** ****************************************************************************
+*** \brief A stem of a layered music
+***
+*** Layers are streamed from an already opened file, loop, and are attached to the music bus.
+*** Unlike music descriptors, they aren't registered in the audio engine: They are
+*** owned and played by their layered music.
+*** ***************************************************************************/
+class MusicLayer : public AudioDescriptor
+{
+public:
+    MusicLayer();
+
+    bool IsSound() const {
+        return false;
+    }
+
+    void SetVolume(float volume);
+
+    //! \brief The volume the layer is fading to.
+    float target_volume;
+
+    //! \brief The layer volume change per millisecond while fading, or 0.0f when not fading.
+    float fade_speed;
+}; // class MusicLayer : public AudioDescriptor
+
+//! \brief A layer volume change waiting for its beat or bar boundary
+class LayerTransition
+{
+public:
+    //! \brief The index of the layer to change
+    uint32_t layer;
+
+    //! \brief The volume to fade the layer to
+    float volume;
+
+    //! \brief The fade duration in milliseconds
+    uint32_t fade_time;
+
+    //! \brief The layered music play time at which the change starts, in milliseconds
+    uint32_t start_time;
+}; // class LayerTransition
+
+} // namespace private_audio
+
+/** ****************************************************************************
+*** \brief Plays several sample-aligned stems of one composition
+***
+*** All the layers are opened when added, so that changing the music intensity
+*** never loads anything during the game. They are always played, paused and
+*** stopped together, and only their volumes vary.
+***
+*** The tempo of the composition is used to delay volume changes to the next
+*** beat or bar. It can be set manually or read from a script file such as:
+*** \code
+*** layered_music = {
+***     tempo = 120, -- in beats per minute
+***     beats_per_bar = 4,
+***     first_beat = 0, -- the time of the first beat in the track, in milliseconds
+***     layers = {
+***         { file = "data/music/battle_base.ogg", volume = 1.0 },
+***         { file = "data/music/battle_drums.ogg", volume = 0.0 },
+***     }
+*** }
+*** \endcode
+***
+*** \note The layers are expected to have the same length. The first layer is the
+*** master stem: the music clock, used to find the beat boundaries, follows its
+*** playing position, and the other layers are sought back to it when they drift
+*** away, e.g. after a buffer underrun.
+*** \note Playing a layered music doesn't stop the active music.
+*** ***************************************************************************/
+class LayeredMusic
+{
+    friend class AudioEngine;
+
+public:
+    LayeredMusic();
+
+    ~LayeredMusic();
+
+    /** \brief Loads the tempo and layers from a script file
+    *** \param script_filename The script containing the layered_music table
+    *** \return False if the table was missing or if no layer could be loaded
+    *** The previous layers are freed first.
+    **/
+    bool LoadLayers(const std::string &script_filename);
+
+    /** \brief Opens a new layer and appends it to the music
+    *** \param filename The ogg or wav file of the stem
+    *** \param volume The layer initial volume, between [0.0, 1.0]
+    *** \return False if the file couldn't be opened
+    *** \note Layers can't be added while the music is playing.
+    **/
+    bool AddLayer(const std::string &filename, float volume = 1.0f);
+
+    //! \brief Stops the music and frees all the layers.
+    void FreeLayers();
+
+    /** \brief Sets the composition tempo, used to synchronize the volume changes
+    *** \param beats_per_minute The tempo. 0.0f disables the synchronization.
+    *** \param beats_per_bar The number of beats in a bar
+    *** \param first_beat_time The time of the first beat in the track, in milliseconds
+    **/
+    void SetTempo(float beats_per_minute, uint32_t beats_per_bar, uint32_t first_beat_time = 0);
+
+    //! \brief Starts all the layers from the beginning, at the same time.
+    bool Play();
+
+    //! \brief Stops all the layers and rewinds them.
+    void Stop();
+
+    //! \brief Pauses all the layers at the same time.
+    void Pause();
+
+    //! \brief Resumes all the layers at the same time.
+    void Resume();
+
+    bool IsPlaying() const {
+        return _playing;
+    }
+
+    uint32_t GetNumberLayers() const {
+        return _layers.size();
+    }
+
+    //! \brief Returns the layer volume, or 0.0f if the layer doesn't exist.
+    float GetLayerVolume(uint32_t layer) const;
+
+    /** \brief Changes the volume of a layer
+    *** \param layer The index of the layer, in the order they were added
+    *** \param volume The volume to reach, between [0.0, 1.0]
+    *** \param fade_time The duration of the volume change, in milliseconds
+    *** \param sync The boundary the change should wait for before starting
+    **/
+    void SetLayerVolume(uint32_t layer, float volume, uint32_t fade_time = 0, MUSIC_SYNC sync = MUSIC_SYNC_IMMEDIATE);
+
+    /** \brief Returns the time before the next beat or bar boundary, in milliseconds
+    *** Returns 0 when the music isn't playing, when no tempo is set or when asking for MUSIC_SYNC_IMMEDIATE.
+    **/
+    uint32_t GetTimeToNextBoundary(MUSIC_SYNC sync) const;
+
+private:
+    //! \brief The stems, in the order they were added.
+    std::vector<private_audio::MusicLayer *> _layers;
+
+    //! \brief The volume changes waiting for their boundary, sorted by start time.
+    std::vector<private_audio::LayerTransition> _pending_transitions;
+
+    //! \brief The composition tempo, in beats per minute.
+    float _beats_per_minute;
+
+    //! \brief The number of beats in a bar.
+    uint32_t _beats_per_bar;
+
+    //! \brief The time of the first beat in the track, in milliseconds.
+    uint32_t _first_beat_time;
+
+    //! \brief The time spent playing since the music was started, in milliseconds.
+    uint32_t _play_time;
+
+    //! \brief The number of samples the master stem played since the music was started.
+    uint64_t _play_samples;
+
+    //! \brief The master stem position within the track at the last update, in samples.
+    uint32_t _last_master_sample;
+
+    //! \brief The length of the track, in milliseconds.
+    uint32_t _track_length;
+
+    //! \brief Whether the music was started and not stopped.
+    bool _playing;
+
+    //! \brief Starts the due volume changes and updates the layer fades. Called by the audio engine.
+    void _Update();
+
+    /** \brief Seeks all the layers to the given sample and starts them in one call.
+    *** \return False if not every layer could get an audio source.
+    **/
+    bool _StartLayers(uint32_t sample);
+
+    //! \brief Returns the position being played by the layer within the track, in samples.
+    uint32_t _GetLayerSample(const private_audio::MusicLayer *layer) const;
+
+    //! \brief Seeks every layer back to the master stem position.
+    void _Resync(uint32_t master_sample);
+
+    /** \brief Pauses and resumes the layers in one call.
+    *** \param by_bus Whether the music bus is the one pausing or resuming the layers.
+    **/
+    void _PauseLayers(bool by_bus);
+    void _ResumeLayers(bool by_bus);
+
+    //! \brief Starts a volume change on a layer.
+    void _StartTransition(const private_audio::LayerTransition &transition);
+}; // class LayeredMusic
+
+} // namespace vt_audio
+
+#endif // __LAYERED_MUSIC_HEADER__
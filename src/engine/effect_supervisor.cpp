@@ -140,8 +140,9 @@ void EffectSupervisor::_UpdateAmbientOverlay(uint32_t frame_time)
 
 void EffectSupervisor::DrawEffects()
 {
-    // Draw the textured ambient overlay
-    if(_info.overlay.active) {
+    // Draw the textured ambient overlay.
+    // It is purely decorative, so it is skipped when the video engine runs at its lowest quality level.
+    if(_info.overlay.active && VideoManager->GetQualityLevel() + 1 < VIDEO_QUALITY_LEVELS) {
         VideoManager->PushState();
         VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_Y_TOP, 0);
         VideoManager->SetStandardCoordSys();
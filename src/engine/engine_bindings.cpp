@@ -26,6 +26,7 @@
 #include "utils/utils_pch.h"
 
 #include "engine/audio/audio.h"
+#include "engine/audio/layered_music.h"
 #include "engine/input.h"
 #include "engine/mode_manager.h"
 #include "engine/script/script.h"
@@ -56,6 +57,48 @@ void BindEngineCode()
             .def("FadeOutActiveMusic", &AudioEngine::FadeOutActiveMusic)
             .def("FadeInActiveMusic", &AudioEngine::FadeInActiveMusic)
             .def("FadeOutAllSounds", &AudioEngine::FadeOutAllSounds)
+            .def("GetBusVolume", &AudioEngine::GetBusVolume)
+            .def("SetBusVolume", &AudioEngine::SetBusVolume)
+            .def("PauseBus", &AudioEngine::PauseBus)
+            .def("ResumeBus", &AudioEngine::ResumeBus)
+            .def("DuckBus", &AudioEngine::DuckBus)
+            .def("UnduckBus", &AudioEngine::UnduckBus)
+
+            .enum_("constants") [
+                // Mixing buses
+                luabind::value("AUDIO_BUS_MASTER", AUDIO_BUS_MASTER),
+                luabind::value("AUDIO_BUS_MUSIC", AUDIO_BUS_MUSIC),
+                luabind::value("AUDIO_BUS_SFX", AUDIO_BUS_SFX),
+                luabind::value("AUDIO_BUS_AMBIENCE", AUDIO_BUS_AMBIENCE),
+                luabind::value("AUDIO_BUS_UI", AUDIO_BUS_UI),
+                luabind::value("AUDIO_BUS_VOICE", AUDIO_BUS_VOICE)
+            ]
+        ];
+
+        luabind::module(vt_script::ScriptManager->GetGlobalState(), "vt_audio")
+        [
+            luabind::class_<LayeredMusic>("LayeredMusic")
+            .def(luabind::constructor<>())
+            .def("LoadLayers", &LayeredMusic::LoadLayers)
+            .def("AddLayer", &LayeredMusic::AddLayer)
+            .def("FreeLayers", &LayeredMusic::FreeLayers)
+            .def("SetTempo", &LayeredMusic::SetTempo)
+            .def("Play", &LayeredMusic::Play)
+            .def("Stop", &LayeredMusic::Stop)
+            .def("Pause", &LayeredMusic::Pause)
+            .def("Resume", &LayeredMusic::Resume)
+            .def("IsPlaying", &LayeredMusic::IsPlaying)
+            .def("GetNumberLayers", &LayeredMusic::GetNumberLayers)
+            .def("GetLayerVolume", &LayeredMusic::GetLayerVolume)
+            .def("SetLayerVolume", &LayeredMusic::SetLayerVolume)
+            .def("GetTimeToNextBoundary", &LayeredMusic::GetTimeToNextBoundary)
+
+            .enum_("constants") [
+                // Layer volume change synchronization
+                luabind::value("MUSIC_SYNC_IMMEDIATE", MUSIC_SYNC_IMMEDIATE),
+                luabind::value("MUSIC_SYNC_BEAT", MUSIC_SYNC_BEAT),
+                luabind::value("MUSIC_SYNC_BAR", MUSIC_SYNC_BAR)
+            ]
         ];
 
     } // End using audio namespaces
@@ -21,6 +21,7 @@
 #include "system.h"
 
 #include "engine/video/video.h"
+#include "engine/video/texture_controller.h"
 #include "engine/audio/audio.h"
 
 #include "modes/mode_help_window.h"
@@ -281,6 +282,7 @@ void ModeEngine::Update()
     // If a Push() or Pop() function was called, we need to adjust the state of the game stack.
     if(_fade_out_finished && _state_change) {
         // Pop however many game modes we need to from the top of the stack
+        bool modes_deleted = (_pop_count != 0);
         while(_pop_count != 0) {
             if(_game_stack.empty()) {
                 PRINT_WARNING << "Tried to pop off more game modes than were on the stack!" << std::endl;
@@ -308,6 +310,11 @@ void ModeEngine::Update()
             SystemManager->ExitGame();
         }
 
+        // The deleted modes images left holes in the texture sheets: Repack them
+        // while the screen is faded out.
+        if(modes_deleted)
+            TextureManager->DefragmentTexSheets();
+
         // Call the newly active game mode's Reset() function to re-initialize the game mode
         _game_stack.back()->Reset();
 
@@ -317,6 +317,7 @@ SystemEngine::SystemEngine():
     _seconds_played(0),
     _milliseconds_played(0),
     _not_done(true),
+    _locale_generation(0),
     _message_speed(vt_gui::DEFAULT_MESSAGE_SPEED),
     _battle_target_cursor_memory(true),
     _game_difficulty(2), // Normal
@@ -474,6 +475,9 @@ bool SystemEngine::SetLanguageLocale(const std::string& lang)
     setenv("LANGUAGE", _current_language_locale.c_str(), 1);
     setenv("LANG", _current_language_locale.c_str(), 1);
 #endif
+
+    // Lets the translated texts know they are outdated.
+    ++_locale_generation;
     return true;
 }
 
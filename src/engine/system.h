@@ -509,6 +509,14 @@ public:
         return _current_language_locale;
     }
 
+    /** \brief Tells how many times the language locale has changed.
+    *** Texts holding a message id can compare it against the value they were
+    *** translated with and translate themselves again lazily when it differs.
+    **/
+    uint32_t GetLocaleGeneration() const {
+        return _locale_generation;
+    }
+
     //! \brief Gives the default locale according to config.
     const std::string& GetDefaultLanguageLocale() const {
         return _default_language_locale;
@@ -629,6 +637,11 @@ private:
     //! \brief The default language locale according to the configuration file.
     std::string _default_language_locale;
 
+    //! \brief Incremented each time the language locale changes.
+    //! Translated texts compare it against the generation they were resolved with
+    //! to know whether they must be translated again.
+    uint32_t _locale_generation;
+
     //! \brief Stores languages properties.
     std::map<std::string, LocaleProperties> _locales_properties;
 
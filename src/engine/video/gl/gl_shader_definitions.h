@@ -156,6 +156,40 @@ namespace shader_definitions
         "        gl_FragColor.b = sum;\n"
         "}\n";
 
+    const char SPRITE_SHARP_BILINEAR_FRAGMENT[] =
+        "#version 110\n"
+        "\n"
+        "//\n"
+        "// Samples a linearly filtered texture as if it was first upscaled\n"
+        "// by an integer factor with the nearest filter, for a fragment's output.\n"
+        "// Texels stay sharp while only their edges get blended.\n"
+        "//\n"
+        "\n"
+        "uniform vec4 u_Color;\n"
+        "uniform sampler2D u_Texture;\n"
+        "\n"
+        "// The texture size (xy) and the integer prescale factors (zw).\n"
+        "uniform vec4 u_ScaleParameters;\n"
+        "\n"
+        "void main(void)\n"
+        "{\n"
+        "        vec2 texel = gl_TexCoord[0].xy * u_ScaleParameters.xy;\n"
+        "        vec2 texel_floored = floor(texel);\n"
+        "        vec2 center_distance = texel - texel_floored - 0.5;\n"
+        "        vec2 region_range = 0.5 - 0.5 / u_ScaleParameters.zw;\n"
+        "        vec2 offset = (center_distance - clamp(center_distance, -region_range, region_range)) * u_ScaleParameters.zw + 0.5;\n"
+        "\n"
+        "        gl_FragColor.rgba = vec4(texture2D(u_Texture, (texel_floored + offset) / u_ScaleParameters.xy));\n"
+        "        gl_FragColor *= gl_Color;\n"
+        "        gl_FragColor *= u_Color;\n"
+        "\n"
+        "        // Alpha Test\n"
+        "        if (gl_FragColor.a <= 0.0)\n"
+        "        {\n"
+        "            discard;\n"
+        "        }\n"
+        "}\n";
+
 } // namespace shader_definition
 
 } // namespace gl
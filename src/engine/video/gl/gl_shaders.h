@@ -30,6 +30,7 @@ enum Shaders
     FragmentSolidGrayscale,
     FragmentSprite,
     FragmentSpriteGrayscale,
+    FragmentSpriteSharpBilinear,
     Count
 };
 
@@ -1015,6 +1015,15 @@ void StillImage::SetHeightKeepRatio(float height)
     SetDimensions(_width * img_ratio, height);
 }
 
+// -----------------------------------------------------------------------------
+// AnimationClock class
+// -----------------------------------------------------------------------------
+
+void AnimationClock::Update(uint32_t elapsed_time)
+{
+    _time += (elapsed_time == 0) ? vt_system::SystemManager->GetUpdateTime() : elapsed_time;
+}
+
 // -----------------------------------------------------------------------------
 // AnimatedImage class
 // -----------------------------------------------------------------------------
@@ -1040,6 +1049,9 @@ void AnimatedImage::Clear()
     ImageDescriptor::Clear();
     _frame_index = 0;
     _frame_counter = 0;
+    _clock = nullptr;
+    _clock_offset = 0;
+    _last_clock_time = 0;
     // clear all animation frame images
     for(std::vector<AnimationFrame>::iterator it = _frames.begin(); it != _frames.end(); ++it)
         (*it).image.Clear();
@@ -1246,6 +1258,8 @@ void AnimatedImage::Draw(const Color &draw_color) const
         return;
     }
 
+    _SyncWithClock();
+
     if (!_blended_animation || _frames[_frame_index].frame_time <= 4
             || _frame_counter > _frames[_frame_index].frame_time / 4) {
         _frames[_frame_index].image.Draw(draw_color);
@@ -1310,7 +1324,8 @@ void AnimatedImage::_DisableGrayscale()
 
 void AnimatedImage::Update(uint32_t elapsed_time)
 {
-    if(_frames.size() <= 1)
+    // The shared clock drives the animation in that case.
+    if(_clock || _frames.size() <= 1)
         return;
 
     // If the frame time is 0, it means the frame is a terminator and should be displayed 'forever'.
@@ -1431,6 +1446,59 @@ void AnimatedImage::RandomizeAnimationFrame() {
     uint32_t index = vt_utils::RandomBoundedInteger(0, nb_frames - 1);
     _frame_index = index;
     _frame_counter = 0;
+    _SetClockOffsetFromFrame();
+}
+
+void AnimatedImage::SetAnimationClock(const AnimationClock* clock)
+{
+    _SyncWithClock();
+    _clock = clock;
+    _SetClockOffsetFromFrame();
+}
+
+void AnimatedImage::_ComputeFrameFromClock() const
+{
+    _last_clock_time = _clock->GetTime();
+    if(_frames.size() <= 1 || _animation_time == 0)
+        return;
+
+    // The time spent since the animation start. The unsigned sum wraps around as intended.
+    uint32_t time = _last_clock_time + _clock_offset;
+
+    uint32_t index = 0;
+    while(true) {
+        uint32_t frame_time = _frames[index].frame_time;
+        // A frame time of 0 means the frame is a terminator and should be displayed 'forever'.
+        if(frame_time == 0) {
+            time = 0;
+            break;
+        }
+        if(time < frame_time)
+            break;
+
+        time -= frame_time;
+        if(++index >= _frames.size()) {
+            // The animation loops: skip the full loops at once.
+            index = 0;
+            time %= _animation_time;
+        }
+    }
+
+    _frame_index = index;
+    _frame_counter = time;
+}
+
+void AnimatedImage::_SetClockOffsetFromFrame()
+{
+    if(!_clock)
+        return;
+
+    uint32_t position = _frame_counter;
+    for(uint32_t i = 0; i < _frame_index && i < _frames.size(); ++i)
+        position += _frames[i].frame_time;
+
+    _last_clock_time = _clock->GetTime();
+    _clock_offset = position - _last_clock_time;
 }
 
 // -----------------------------------------------------------------------------
@@ -92,6 +92,7 @@ class StillImage;
 class ImageDescriptor
 {
     friend class VideoEngine;
+    friend class ImageBatch;
 
 public:
     ImageDescriptor();
@@ -348,6 +349,7 @@ class StillImage : public ImageDescriptor
     friend class AnimatedImage;
     friend class CompositeImage;
     friend class TextureController;
+    friend class ImageBatch;
     friend class vt_mode_manager::ParticleSystem;
 
 public:
@@ -540,6 +542,42 @@ public:
 
 } // namespace private_video
 
+/** ****************************************************************************
+*** \brief A shared time reference for animated images
+***
+*** Animated images sharing the same frame timing can subscribe to a clock
+*** instead of being updated one by one. Only the clock is then updated each
+*** frame, and each subscribed image computes its current frame on demand
+*** from the clock time and its own start offset.
+***
+*** \note The clock must outlive every animated image subscribed to it.
+*** ***************************************************************************/
+class AnimationClock
+{
+public:
+    AnimationClock():
+        _time(0)
+    {
+    }
+
+    //! \brief Advances the clock by the given time, or by the game update time if equal to 0.
+    void Update(uint32_t elapsed_time = 0);
+
+    //! \brief Sets the clock time back to 0.
+    void Reset() {
+        _time = 0;
+    }
+
+    //! \brief Returns the time elapsed on the clock, in milliseconds.
+    uint32_t GetTime() const {
+        return _time;
+    }
+
+private:
+    //! \brief The time elapsed on the clock, in milliseconds.
+    uint32_t _time;
+};
+
 /** ****************************************************************************
 *** \brief Represents an animated image with both frames and timing information
 ***
@@ -634,6 +672,22 @@ public:
     void ResetAnimation() {
         _frame_index = 0;
         _frame_counter = 0;
+        if (_clock)
+            _clock_offset = 0 - _clock->GetTime();
+    }
+
+    /** \brief Subscribes the animation to a shared clock.
+    *** \param clock The clock to follow, or nullptr to go back to per-instance updates.
+    ***
+    *** Once subscribed, Update() calls are ignored and the current frame
+    *** is computed from the clock time when needed. The current frame and progress
+    *** are kept in place when subscribing.
+    **/
+    void SetAnimationClock(const AnimationClock* clock);
+
+    //! \brief Returns the clock the animation is subscribed to, or nullptr.
+    const AnimationClock* GetAnimationClock() const {
+        return _clock;
     }
 
     /** \brief Called every frame to update the animation's current frame
@@ -681,11 +735,13 @@ public:
 
     //! \brief Retuns a pointer to the StillImage representing the current frame
     StillImage *GetCurrentFrame() const {
+        _SyncWithClock();
         return GetFrame(_frame_index);
     }
 
     //! \brief Returns the index number of the current frame in the animation.
     uint32_t GetCurrentFrameIndex() const {
+        _SyncWithClock();
         return _frame_index;
     }
 
@@ -704,6 +760,7 @@ public:
 
     //! \brief Returns the number of milliseconds that the current frame has been shown for.
     uint32_t GetTimeProgress() const {
+        _SyncWithClock();
         return _frame_counter;
     }
 
@@ -713,6 +770,7 @@ public:
     *** a divide by zero exception at run-time.
     **/
     float GetPercentProgress() const {
+        _SyncWithClock();
         return static_cast<float>(_frame_counter) / _frames[_frame_index].frame_time;
     }
 
@@ -723,6 +781,7 @@ public:
 
     //! \brief Returns true if the animation has ended.
     bool IsAnimationFinished() const {
+        _SyncWithClock();
         return _frames[_frame_index].frame_time == 0;
     }
 
@@ -772,6 +831,7 @@ public:
         if(index > _frames.size()) return;
         _frame_index = index;
         _frame_counter = 0;
+        _SetClockOffsetFromFrame();
     }
 
     /** \brief Sets a random frame index to the animation.
@@ -786,6 +846,7 @@ public:
     **/
     void SetTimeProgress(uint32_t time) {
         _frame_counter = time;
+        _SetClockOffsetFromFrame();
     }
 
     //! \brief Sets whether the animation frames will blend from one to another.
@@ -801,10 +862,20 @@ public:
 
 private:
     //! \brief The index of which animation frame to display.
-    uint32_t _frame_index;
+    //! \note Mutable since it is computed on demand when following a clock.
+    mutable uint32_t _frame_index;
 
     //! \brief Counts how long each frame has been shown for.
-    uint32_t _frame_counter;
+    mutable uint32_t _frame_counter;
+
+    //! \brief The shared clock driving the animation, or nullptr when updated per instance.
+    const AnimationClock* _clock;
+
+    //! \brief The animation time at clock time 0, in milliseconds. Wraps around on purpose.
+    uint32_t _clock_offset;
+
+    //! \brief The clock time at which the current frame was last computed.
+    mutable uint32_t _last_clock_time;
 
     //! \brief Tells whether the animation frames are blended one with another.
     bool _blended_animation;
@@ -820,6 +891,20 @@ private:
 
     //! \brief Disables grayscale for all image frames
     void _DisableGrayscale();
+
+    /** \brief Computes the current frame and counter from the clock time.
+    *** Does nothing when not following a clock or when the clock time didn't change.
+    **/
+    void _SyncWithClock() const {
+        if (_clock && _clock->GetTime() != _last_clock_time)
+            _ComputeFrameFromClock();
+    }
+
+    //! \brief Computes the current frame and counter from the clock time. See _SyncWithClock().
+    void _ComputeFrameFromClock() const;
+
+    //! \brief Sets the clock offset so that the current frame and counter are kept.
+    void _SetClockOffsetFromFrame();
 };
 
 /** ****************************************************************************
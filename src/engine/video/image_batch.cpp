@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+//            Copyright (C) 2012-2016 by Bertram (Valyria Tear)
+//                         All Rights Reserved
+//
+// This code is licensed under the GNU GPL version 2. It is free software
+// and you may modify it and/or redistribute it under the terms of this license.
+// See http://www.gnu.org/copyleft/gpl.html for details.
+////////////////////////////////////////////////////////////////////////////////
+
+/** ****************************************************************************
+*** \file    image_batch.cpp
+*** \author  Valyria Tear team, https://github.com/ValyriaTear/ValyriaTear/issues
+*** \brief   Source file for the image batch class.
+*** ***************************************************************************/
+
+#include "utils/utils_pch.h"
+#include "image_batch.h"
+
+#include "image.h"
+#include "texture_controller.h"
+#include "video.h"
+
+namespace vt_video
+{
+
+void ImageBatch::Clear()
+{
+    _quad_groups.clear();
+}
+
+bool ImageBatch::IsOutdated() const
+{
+    return (!_quad_groups.empty() && _layout_version != TextureManager->GetTexSheetsLayoutVersion());
+}
+
+void ImageBatch::AddImage(const StillImage& image, float x, float y, const Color& draw_color)
+{
+    // Don't add anything if this image is completely transparent (invisible).
+    if (vt_utils::IsFloatEqual(draw_color[3], 0.0f))
+        return;
+
+    const private_video::Context& current_context = VideoManager->_current_context;
+    float horizontal_direction = current_context.coordinate_system.GetHorizontalDirection();
+    float vertical_direction = current_context.coordinate_system.GetVerticalDirection();
+
+    // Same orientation computations as ImageDescriptor::_DrawOrientation()
+    x += image._x_offset;
+    y += image._y_offset;
+    x += ((current_context.x_align + 1) * image._width) * 0.5f * -horizontal_direction;
+    y += ((current_context.y_align + 1) * image._height) * 0.5f * -vertical_direction;
+
+    float x_scale = horizontal_direction < 0.0f ? -image._width : image._width;
+    float y_scale = vertical_direction < 0.0f ? -image._height : image._height;
+
+    Color colors[4];
+    for (uint32_t i = 0; i < 4; ++i)
+        colors[i] = (image._unichrome_vertices ? image._color[0] : image._color[i]) * draw_color;
+
+    private_video::BaseTexture* texture = image._texture;
+    float s0 = 0.0f;
+    float s1 = 1.0f;
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    if (texture) {
+        s0 = texture->u1 + (image._u1 * (texture->u2 - texture->u1));
+        s1 = texture->u1 + (image._u2 * (texture->u2 - texture->u1));
+        t0 = texture->v1 + (image._v1 * (texture->v2 - texture->v1));
+        t1 = texture->v1 + (image._v2 * (texture->v2 - texture->v1));
+    }
+
+    QuadGroup& group = _GetQuadGroup(texture ? texture->texture_sheet : nullptr, image._smooth);
+    _AddQuad(group,
+             x + image._u1 * x_scale, y + image._v1 * y_scale,
+             x + image._u2 * x_scale, y + image._v2 * y_scale,
+             s0, s1, t0, t1, colors);
+}
+
+void ImageBatch::AddRectangle(float x, float y, float width, float height, const Color& color)
+{
+    const private_video::Context& current_context = VideoManager->_current_context;
+    float horizontal_direction = current_context.coordinate_system.GetHorizontalDirection();
+    float vertical_direction = current_context.coordinate_system.GetVerticalDirection();
+
+    x += ((current_context.x_align + 1) * width) * 0.5f * -horizontal_direction;
+    y += ((current_context.y_align + 1) * height) * 0.5f * -vertical_direction;
+
+    float x_scale = horizontal_direction < 0.0f ? -width : width;
+    float y_scale = vertical_direction < 0.0f ? -height : height;
+
+    const Color colors[4] = { color, color, color, color };
+    QuadGroup& group = _GetQuadGroup(nullptr, false);
+    _AddQuad(group, x, y, x + x_scale, y + y_scale, 0.0f, 1.0f, 0.0f, 1.0f, colors);
+}
+
+void ImageBatch::Draw() const
+{
+    if (_quad_groups.empty())
+        return;
+
+    VideoManager->PushMatrix();
+    VideoManager->Move(0.0f, 0.0f);
+
+    const private_video::Context& current_context = VideoManager->_current_context;
+    if (VideoManager->IsScreenShaking()) {
+        // Calculate x and y draw offsets due to any screen shaking effects
+        const CoordSys& coordinate_system = current_context.coordinate_system;
+        float x_shake = VideoManager->_x_shake * (coordinate_system.GetRight() - coordinate_system.GetLeft()) / VIDEO_STANDARD_RES_WIDTH;
+        float y_shake = VideoManager->_y_shake * (coordinate_system.GetTop() - coordinate_system.GetBottom()) / VIDEO_STANDARD_RES_HEIGHT;
+        VideoManager->MoveRelative(x_shake * coordinate_system.GetHorizontalDirection(),
+                                   y_shake * coordinate_system.GetVerticalDirection());
+    }
+
+    VideoManager->EnableBlending();
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Normal blending
+
+    for (uint32_t i = 0; i < _quad_groups.size(); ++i) {
+        const QuadGroup& group = _quad_groups[i];
+
+        gl::ShaderProgram* shader_program = nullptr;
+        if (group.texture_sheet) {
+            VideoManager->EnableTexture2D();
+            TextureManager->_BindTexture(group.texture_sheet->tex_id);
+            group.texture_sheet->Smooth(group.smooth);
+            shader_program = VideoManager->LoadShaderProgram(gl::shader_programs::Sprite);
+        }
+        else {
+            VideoManager->DisableTexture2D();
+            shader_program = VideoManager->LoadShaderProgram(gl::shader_programs::Solid);
+        }
+        assert(shader_program != nullptr);
+
+        VideoManager->DrawParticleSystem(shader_program,
+                                         const_cast<float*>(&group.vertex_positions[0]),
+                                         const_cast<float*>(&group.vertex_texture_coordinates[0]),
+                                         const_cast<float*>(&group.vertex_colors[0]),
+                                         group.vertex_positions.size() / 3);
+    }
+
+    VideoManager->UnloadShaderProgram();
+    VideoManager->PopMatrix();
+}
+
+ImageBatch::QuadGroup& ImageBatch::_GetQuadGroup(private_video::TexSheet* texture_sheet, bool smooth)
+{
+    if (!_quad_groups.empty()) {
+        QuadGroup& last_group = _quad_groups.back();
+        // Colored quads don't care about smoothing.
+        if (last_group.texture_sheet == texture_sheet && (!texture_sheet || last_group.smooth == smooth))
+            return last_group;
+    }
+
+    // The texture coordinates are only valid for the current texture sheets layout.
+    if (_quad_groups.empty())
+        _layout_version = TextureManager->GetTexSheetsLayoutVersion();
+
+    _quad_groups.push_back(QuadGroup());
+    QuadGroup& group = _quad_groups.back();
+    group.texture_sheet = texture_sheet;
+    group.smooth = smooth;
+    return group;
+}
+
+void ImageBatch::_AddQuad(QuadGroup& group, float x1, float y1, float x2, float y2,
+                          float s0, float s1, float t0, float t1, const Color* colors)
+{
+    // Same vertices order and texture coordinates as ImageDescriptor::_DrawTexture()
+    const float vertex_positions[] = {
+        x1, y1, 0.0f,
+        x2, y1, 0.0f,
+        x2, y2, 0.0f,
+        x1, y2, 0.0f
+    };
+    const float vertex_texture_coordinates[] = {
+        s0, t1,
+        s1, t1,
+        s1, t0,
+        s0, t0
+    };
+
+    group.vertex_positions.insert(group.vertex_positions.end(),
+                                  vertex_positions, vertex_positions + 12);
+    group.vertex_texture_coordinates.insert(group.vertex_texture_coordinates.end(),
+                                            vertex_texture_coordinates, vertex_texture_coordinates + 8);
+    for (uint32_t i = 0; i < 4; ++i)
+        group.vertex_colors.insert(group.vertex_colors.end(), colors[i].GetColors(), colors[i].GetColors() + 4);
+}
+
+} // namespace vt_video
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+//            Copyright (C) 2012-2016 by Bertram (Valyria Tear)
+//                         All Rights Reserved
+//
+// This code is licensed under the GNU GPL version 2. It is free software
+// and you may modify it and/or redistribute it under the terms of this license.
+// See http://www.gnu.org/copyleft/gpl.html for details.
+////////////////////////////////////////////////////////////////////////////////
+
+/** ****************************************************************************
+*** \file    image_batch.h
+*** \author  Valyria Tear team, https://github.com/ValyriaTear/ValyriaTear/issues
+*** \brief   Header file for the image batch class.
+***
+*** An image batch gathers the quads of many still images and rectangles
+*** into vertex arrays, so that they can be drawn with one draw call per
+*** texture sheet instead of one per image.
+*** ***************************************************************************/
+
+#ifndef __IMAGE_BATCH_HEADER__
+#define __IMAGE_BATCH_HEADER__
+
+#include "color.h"
+
+#include <vector>
+
+namespace vt_video
+{
+
+class StillImage;
+
+namespace private_video
+{
+class TexSheet;
+}
+
+/** ****************************************************************************
+*** \brief Gathers static quads to draw them in as few draw calls as possible.
+***
+*** Images and rectangles are added at a given position using the draw flags
+*** (alignment and coordinate system) active at the time they are added,
+*** like if they were drawn right away. Consecutive quads using the same texture
+*** sheet are then drawn together. Hence, adding the quads sorted by texture
+*** sheet gives the fewest draw calls.
+***
+*** The batch is meant to be kept between frames and rebuilt only when its content
+*** changed, as for HUD elements.
+***
+*** \note Flip draw flags and custom blending modes aren't supported: The quads
+*** are always drawn using normal alpha blending. Screen shaking is applied when drawing.
+*** \note The batch doesn't hold references on the images textures:
+*** The batch must be cleared or rebuilt when the images it contains get freed,
+*** or when it is outdated because the texture sheets were repacked.
+*** ***************************************************************************/
+class ImageBatch
+{
+public:
+    ImageBatch() :
+        _layout_version(0)
+    {}
+
+    ~ImageBatch()
+    {}
+
+    //! \brief Removes all the quads from the batch.
+    void Clear();
+
+    //! \brief Tells whether the batch doesn't contain anything to draw.
+    bool IsEmpty() const {
+        return _quad_groups.empty();
+    }
+
+    /** \brief Tells whether the images were moved to other texture sheets since the batch was built.
+    *** The batch must then be rebuilt before being drawn.
+    **/
+    bool IsOutdated() const;
+
+    /** \brief Adds a still image quad to the batch.
+    *** \param image The image to add. Images without texture are added as colored quads.
+    *** \param x, y The position the image would have been drawn at.
+    *** \param draw_color The color to modulate the image with.
+    **/
+    void AddImage(const StillImage& image, float x, float y,
+                  const Color& draw_color = vt_video::Color::white);
+
+    /** \brief Adds a colored rectangle to the batch, as drawn by VideoEngine::DrawRectangle().
+    *** \param x, y The position the rectangle would have been drawn at.
+    **/
+    void AddRectangle(float x, float y, float width, float height, const Color& color);
+
+    //! \brief Draws the whole batch on screen.
+    void Draw() const;
+
+private:
+    //! \brief Consecutive quads sharing the same texture sheet and smoothing.
+    struct QuadGroup {
+        //! \brief The texture sheet used, or nullptr for colored quads.
+        private_video::TexSheet* texture_sheet;
+
+        //! \brief Whether the texture sheet should be smoothed.
+        bool smooth;
+
+        //! \brief The vertex arrays: 3 position floats, 2 texture coordinates and 4 color components per vertex.
+        std::vector<float> vertex_positions;
+        std::vector<float> vertex_texture_coordinates;
+        std::vector<float> vertex_colors;
+    };
+
+    //! \brief The quad groups to draw, in order.
+    std::vector<QuadGroup> _quad_groups;
+
+    //! \brief The texture sheets layout version at the time the batch was built.
+    uint32_t _layout_version;
+
+    //! \brief Returns the quad group to add the next quad to, creating a new one if needed.
+    QuadGroup& _GetQuadGroup(private_video::TexSheet* texture_sheet, bool smooth);
+
+    /** \brief Adds a quad to the given group
+    *** \param x1, y1, x2, y2 The opposite quad corners in the current coordinate system.
+    *** \param s0, s1, t0, t1 The quad texture coordinates.
+    *** \param colors The four vertices colors.
+    **/
+    void _AddQuad(QuadGroup& group, float x1, float y1, float x2, float y2,
+                  float s0, float s1, float t0, float t1, const Color* colors);
+};
+
+} // namespace vt_video
+
+#endif // __IMAGE_BATCH_HEADER__
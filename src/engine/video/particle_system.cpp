@@ -357,22 +357,30 @@ void ParticleSystem::Update(float frame_time, const EffectParameters &params)
     // update properties of existing particles
     _UpdateParticles(frame_time, params);
 
+    // The continuous emissions are reduced when the video engine lowers the quality.
+    // Bursts are kept untouched as they usually illustrate an action.
+    const float quality_factor = VideoManager->GetQualityFactor();
+    int32_t max_particles = static_cast<int32_t>(_system_def->max_particles * quality_factor);
+    if(max_particles < 1)
+        max_particles = 1;
+
     // figure out how many particles need to be emitted this frame
     int32_t num_particles_to_emit = 0;
     if(!_stopped) {
         if(_system_def->emitter._emitter_mode == EMITTER_MODE_ALWAYS) {
-            num_particles_to_emit = _system_def->max_particles - _num_particles;
+            num_particles_to_emit = max_particles - _num_particles;
         } else if(_system_def->emitter._emitter_mode != EMITTER_MODE_BURST) {
-            float time_low  = _last_update_time * _system_def->emitter._emission_rate;
-            float time_high = _age * _system_def->emitter._emission_rate;
+            float emission_rate = _system_def->emitter._emission_rate * quality_factor;
+            float time_low  = _last_update_time * emission_rate;
+            float time_high = _age * emission_rate;
 
             time_low  = floorf(time_low);
             time_high = ceilf(time_high);
 
             num_particles_to_emit = static_cast<int32_t>(time_high - time_low) - 1;
 
-            if(num_particles_to_emit + _num_particles > _system_def->max_particles)
-                num_particles_to_emit = _system_def->max_particles - _num_particles;
+            if(num_particles_to_emit + _num_particles > max_particles)
+                num_particles_to_emit = max_particles - _num_particles;
         } else {
             num_particles_to_emit = _system_def->max_particles;
         }
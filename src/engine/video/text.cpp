@@ -44,6 +44,30 @@ TextSupervisor *TextManager = nullptr;
 const uint16_t NEW_LINE = '\n';
 const uint16_t SPACE_CHAR = 0x20;
 
+//! \brief Locks the given mutex for the lifetime of the object.
+class MutexLock
+{
+public:
+    explicit MutexLock(SDL_mutex* mutex):
+        _mutex(mutex)
+    {
+        if (_mutex)
+            SDL_LockMutex(_mutex);
+    }
+
+    ~MutexLock()
+    {
+        if (_mutex)
+            SDL_UnlockMutex(_mutex);
+    }
+
+private:
+    SDL_mutex* _mutex;
+
+    MutexLock(const MutexLock&);
+    MutexLock& operator=(const MutexLock&);
+};
+
 // -----------------------------------------------------------------------------
 // FontProperties class
 // -----------------------------------------------------------------------------
@@ -240,6 +264,15 @@ TextTexture::~TextTexture()
 }
 
 bool TextTexture::Regenerate()
+{
+    ImageMemory buffer;
+    if(TextManager->_RenderText(string, style, buffer) == false)
+        return false;
+
+    return Regenerate(buffer);
+}
+
+bool TextTexture::Regenerate(ImageMemory& buffer)
 {
     if(texture_sheet) {
         texture_sheet->RemoveTexture(this);
@@ -247,8 +280,7 @@ bool TextTexture::Regenerate()
         texture_sheet = nullptr;
     }
 
-    ImageMemory buffer;
-    if(TextManager->_RenderText(string, style, buffer) == false)
+    if(buffer.GetWidth() == 0 || buffer.GetHeight() == 0)
         return false;
 
     width = buffer.GetWidth();
@@ -377,16 +409,20 @@ void TextElement::SetTexture(TextTexture *texture)
 
 TextImage::TextImage() :
     ImageDescriptor(),
+    _locale_generation(0),
     _style(TextManager->GetDefaultStyle()),
-    _max_width(1024)
+    _max_width(1024),
+    _rendering_request(0)
 {
 }
 
 TextImage::TextImage(const ustring& text, const TextStyle& style) :
     ImageDescriptor(),
     _text(text),
+    _locale_generation(0),
     _style(style),
-    _max_width(1024)
+    _max_width(1024),
+    _rendering_request(0)
 {
     _Regenerate();
 }
@@ -394,8 +430,10 @@ TextImage::TextImage(const ustring& text, const TextStyle& style) :
 TextImage::TextImage(const std::string& text, const TextStyle& style) :
     ImageDescriptor(),
     _text(MakeUnicodeString(text)),
+    _locale_generation(0),
     _style(style),
-    _max_width(1024)
+    _max_width(1024),
+    _rendering_request(0)
 {
     _Regenerate();
 }
@@ -403,12 +441,19 @@ TextImage::TextImage(const std::string& text, const TextStyle& style) :
 TextImage::TextImage(const TextImage &copy) :
     ImageDescriptor(copy),
     _text(copy._text),
+    _message_id(copy._message_id),
+    _locale_generation(copy._locale_generation),
     _style(copy._style),
-    _max_width(copy._max_width)
+    _max_width(copy._max_width),
+    _rendering_request(0)
 {
     for(uint32_t i = 0; i < copy._text_sections.size(); i++) {
         _text_sections.push_back(new TextElement(*(copy._text_sections[i])));
     }
+
+    // Rendering requests aren't shared, so request the new text again.
+    if(copy._rendering_request != 0)
+        _Regenerate();
 }
 
 TextImage &TextImage::operator=(const TextImage &copy)
@@ -417,6 +462,8 @@ TextImage &TextImage::operator=(const TextImage &copy)
     if(this == &copy)
         return *this;
 
+    _CancelRendering();
+
     // Remove references to any existing text sections
     for(uint32_t i = 0; i < _text_sections.size(); ++i)
         delete _text_sections[i];
@@ -424,18 +471,26 @@ TextImage &TextImage::operator=(const TextImage &copy)
     _text_sections.clear();
 
     _text = copy._text;
+    _message_id = copy._message_id;
+    _locale_generation = copy._locale_generation;
     _style = copy._style;
     _max_width = copy._max_width;
     for(uint32_t i = 0; i < copy._text_sections.size(); ++i)
         _text_sections.push_back(new TextElement(*(copy._text_sections[i])));
 
+    // Rendering requests aren't shared, so request the new text again.
+    if(copy._rendering_request != 0)
+        _Regenerate();
+
     return *this;
 }
 
 void TextImage::Clear()
 {
+    _CancelRendering();
     ImageDescriptor::Clear();
     _text.clear();
+    _message_id.clear();
     for(uint32_t i = 0; i < _text_sections.size(); ++i)
         delete _text_sections[i];
 
@@ -452,6 +507,14 @@ void TextImage::Draw(const Color& draw_color) const
     if (IsFloatEqual(draw_color[3], 0.0f))
         return;
 
+    // Only translate the text again when it is actually shown after a language change.
+    if (!_message_id.empty() && _locale_generation != vt_system::SystemManager->GetLocaleGeneration())
+        const_cast<TextImage *>(this)->_UpdateTranslation();
+
+    // Upload the new text lines once they are rendered.
+    if (_rendering_request != 0)
+        const_cast<TextImage *>(this)->_UpdateRendering();
+
     // Save the draw cursor position before drawing this text.
     VideoManager->PushMatrix();
 
@@ -476,40 +539,121 @@ void TextImage::Draw(const Color& draw_color) const
     VideoManager->PopMatrix();
 }
 
-void TextImage::_Regenerate()
+void TextImage::SetTranslatableText(const std::string &message_id)
 {
-    _width = 0.0f;
-    _height = 0.0f;
+    if (_message_id == message_id && _locale_generation == vt_system::SystemManager->GetLocaleGeneration())
+        return;
 
-    for (uint32_t i = 0; i < _text_sections.size(); ++i)
-        delete _text_sections[i];
+    _message_id = message_id;
+    _locale_generation = vt_system::SystemManager->GetLocaleGeneration();
+    _text = vt_system::UTranslate(_message_id);
+    _Regenerate();
+}
 
-    _text_sections.clear();
+void TextImage::_UpdateTranslation()
+{
+    _locale_generation = vt_system::SystemManager->GetLocaleGeneration();
 
-    if(_text.empty())
+    ustring text = vt_system::UTranslate(_message_id);
+    if (_text == text)
         return;
 
+    _text = text;
+    _Regenerate();
+}
+
+void TextImage::_Regenerate()
+{
+    // The previously requested text is outdated.
+    _CancelRendering();
+
+    _width = 0.0f;
+    _height = 0.0f;
+
     FontProperties* fp = _style.GetFontProperties();
-    if (fp == nullptr || fp->ttf_font == nullptr) {
+    if(_text.empty()) {
+        _SetTextSections(std::vector<ustring>(), nullptr, fp);
+        return;
+    }
+
+    if(fp == nullptr || fp->ttf_font == nullptr) {
         IF_PRINT_WARNING(VIDEO_DEBUG) << "invalid font or font properties" << std::endl;
+        _SetTextSections(std::vector<ustring>(), nullptr, fp);
         return;
     }
 
-    // Iterate through each line of text and render a text texture for each one.
     std::vector<ustring> lines_array = TextManager->WrapText(_text, fp->ttf_font, _max_width);
-    std::vector<ustring>::iterator line_iter;
-    for(line_iter = lines_array.begin(); line_iter != lines_array.end(); ++line_iter) {
+
+    // Compute the text dimensions right away, so that they can be used
+    // while the lines are being rendered.
+    for(uint32_t i = 0; i < lines_array.size(); ++i) {
+        const ustring& line = lines_array[i];
+        if(!line.empty() && !(line == ustring(&NEW_LINE))) {
+            float line_width = static_cast<float>(TextManager->CalculateTextWidth(fp->ttf_font, line));
+            if(line_width > _width)
+                _width = line_width;
+        }
+        _height += fp->line_skip;
+    }
+
+    // Let the text rendering thread rasterize the lines.
+    // The previous text sections are drawn until the new ones are ready.
+    _rendering_request = TextManager->_RequestTextRendering(lines_array, fp);
+    if(_rendering_request != 0)
+        return;
+
+    // Otherwise, render them right away.
+    _SetTextSections(lines_array, nullptr, fp);
+} // void TextImage::_Regenerate()
+
+void TextImage::_UpdateRendering()
+{
+    TextRenderingRequest* request = TextManager->_RetrieveRenderedText(_rendering_request);
+    if(request == nullptr)
+        return;
+
+    _rendering_request = 0;
+    _SetTextSections(request->lines, &request->buffers, request->font_properties);
+    delete request;
+}
+
+void TextImage::_CancelRendering()
+{
+    if(_rendering_request == 0)
+        return;
+
+    // The text supervisor may already be destroyed, along with all its requests.
+    if(TextManager)
+        TextManager->_CancelTextRendering(_rendering_request);
+    _rendering_request = 0;
+}
+
+void TextImage::_SetTextSections(const std::vector<ustring>& lines,
+                                 std::vector<ImageMemory>* buffers,
+                                 FontProperties* font_properties)
+{
+    _width = 0.0f;
+    _height = 0.0f;
+
+    for (uint32_t i = 0; i < _text_sections.size(); ++i)
+        delete _text_sections[i];
+
+    _text_sections.clear();
+
+    // Iterate through each line of text and create a text texture for each one.
+    for(uint32_t i = 0; i < lines.size(); ++i) {
+        const ustring& line = lines[i];
 
         TextElement *new_element = new TextElement();
         // If this line is only a newline character or is an empty string, create an empty TextElement object
-        if((*line_iter) == ustring(&NEW_LINE) || (*line_iter).empty()) {
-            new_element->SetDimensions(0.0f, static_cast<float>(fp->line_skip));
+        if(line == ustring(&NEW_LINE) || line.empty()) {
+            new_element->SetDimensions(0.0f, static_cast<float>(font_properties->line_skip));
         }
         // Otherwise, create a new TextTexture to be managed by the new element
         else {
-            // PRINT_DEBUG << **line_iter << std::endl;
-            TextTexture *texture = new TextTexture(*line_iter, _style);
-            if(texture->Regenerate() == false) {
+            TextTexture *texture = new TextTexture(line, _style);
+            bool regenerated = buffers ? texture->Regenerate((*buffers)[i]) : texture->Regenerate();
+            if(regenerated == false) {
                 IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TextTexture::_Regenerate() failed" << std::endl;
             }
             TextureManager->_RegisterTextTexture(texture);
@@ -523,9 +667,9 @@ void TextImage::_Regenerate()
         _text_sections.push_back(new_element);
 
         // Increase height by the font specified line height
-        _height += fp->line_skip;
+        _height += font_properties->line_skip;
     }
-} // void TextImage::_Regenerate()
+}
 
 // -----------------------------------------------------------------------------
 // TextSupervisor class
@@ -534,7 +678,15 @@ void TextImage::_Regenerate()
 TextSupervisor::TextSupervisor() :
     _text_texture(0),
     _text_texture_width(0),
-    _text_texture_height(0)
+    _text_texture_height(0),
+    _font_mutex(SDL_CreateMutex()),
+    _rendering_thread(nullptr),
+    _requests_mutex(SDL_CreateMutex()),
+    _requests_condition(SDL_CreateCond()),
+    _processed_request(0),
+    _processed_request_cancelled(false),
+    _next_request_id(1),
+    _stop_rendering_thread(false)
 {
     glGenTextures(1, &_text_texture);
     if (_text_texture == 0) {
@@ -545,6 +697,9 @@ TextSupervisor::TextSupervisor() :
 
 TextSupervisor::~TextSupervisor()
 {
+    // Stop the text rendering thread before freeing the fonts it uses.
+    _StopRenderingThread();
+
     // Clean up the text texture.
     if (_text_texture != 0) {
         GLuint textures[] = { _text_texture };
@@ -557,6 +712,10 @@ TextSupervisor::~TextSupervisor()
         delete it->second;
 
     TTF_Quit();
+
+    SDL_DestroyCond(_requests_condition);
+    SDL_DestroyMutex(_requests_mutex);
+    SDL_DestroyMutex(_font_mutex);
 }
 
 bool TextSupervisor::SingletonInitialize()
@@ -566,6 +725,12 @@ bool TextSupervisor::SingletonInitialize()
         return false;
     }
 
+    // Start the text rendering thread. Text is rendered synchronously when it isn't available.
+    if(_font_mutex && _requests_mutex && _requests_condition)
+        _rendering_thread = SDL_CreateThread(_RenderingThread, "TextRendering", this);
+    if(_rendering_thread == nullptr)
+        PRINT_WARNING << "Unable to create the text rendering thread: " << SDL_GetError() << std::endl;
+
     return true;
 }
 
@@ -719,6 +884,9 @@ bool TextSupervisor::_LoadFont(const std::string& textstyle_name, const std::str
             return true;
     }
 
+    // The font can't be swapped while the text rendering thread uses it.
+    MutexLock font_lock(_font_mutex);
+
     // Attempt to load the font
     TTF_Font *font = TTF_OpenFont(font_filename.c_str(), font_size);
     if(font == nullptr) {
@@ -763,6 +931,7 @@ void TextSupervisor::_FreeFont(const std::string &font_name)
     }
 
     // Free the font and remove it from the font cache
+    MutexLock font_lock(_font_mutex);
     delete it->second;
 
     // Remove the data from the map once freed.
@@ -845,6 +1014,7 @@ int32_t TextSupervisor::CalculateTextWidth(TTF_Font* ttf_font, const vt_utils::u
         return -1;
     }
 
+    MutexLock font_lock(_font_mutex);
     int32_t width;
     if(TTF_SizeUNICODE(ttf_font, text.c_str(), &width, nullptr) == -1) {
         IF_PRINT_WARNING(VIDEO_DEBUG) << "Call to TTF_SizeUNICODE failed with TTF error: " << TTF_GetError() << std::endl;
@@ -861,6 +1031,7 @@ int32_t TextSupervisor::CalculateTextWidth(TTF_Font* ttf_font, const std::string
         return -1;
     }
 
+    MutexLock font_lock(_font_mutex);
     int32_t width;
     if(TTF_SizeText(ttf_font, text.c_str(), &width, nullptr) == -1) {
         IF_PRINT_WARNING(VIDEO_DEBUG) << "Call to TTF_SizeText failed with TTF error: " << TTF_GetError() << std::endl;
@@ -1004,22 +1175,27 @@ void TextSupervisor::_RenderText(const uint16_t* text, FontProperties* font_prop
         return;
     }
 
-    // Render the text.
-    const SDL_Color white = { 255, 255, 255, 255 };
-    SDL_Surface* surface = TTF_RenderUNICODE_Blended(font_properties->ttf_font, text, white);
-    if (surface == nullptr) {
-        IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_RenderUNICODE_Blended() failed" << std::endl;
-        assert(surface != nullptr);
-        return;
-    }
-
-    // Retrieve the size of the text.
+    SDL_Surface* surface = nullptr;
     int32_t font_width = 0, font_height = 0;
-    if (TTF_SizeUNICODE(font_properties->ttf_font, text, &font_width, &font_height) != 0) {
-        IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_SizeUNICODE() failed" << std::endl;
-        SDL_FreeSurface(surface);
-        assert(false);
-        return;
+    {
+        MutexLock font_lock(_font_mutex);
+
+        // Render the text.
+        const SDL_Color white = { 255, 255, 255, 255 };
+        surface = TTF_RenderUNICODE_Blended(font_properties->ttf_font, text, white);
+        if (surface == nullptr) {
+            IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_RenderUNICODE_Blended() failed" << std::endl;
+            assert(surface != nullptr);
+            return;
+        }
+
+        // Retrieve the size of the text.
+        if (TTF_SizeUNICODE(font_properties->ttf_font, text, &font_width, &font_height) != 0) {
+            IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_SizeUNICODE() failed" << std::endl;
+            SDL_FreeSurface(surface);
+            assert(false);
+            return;
+        }
     }
 
     // Enable texturing.
@@ -1134,22 +1310,27 @@ void TextSupervisor::_RenderText(const uint16_t* text, FontProperties* font_prop
         return;
     }
 
-    // Render the text.
-    const SDL_Color white = { 255, 255, 255, 255 };
-    SDL_Surface* surface = TTF_RenderUNICODE_Blended(font_properties->ttf_font, text, white);
-    if (surface == nullptr) {
-        IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_RenderUNICODE_Blended() failed" << std::endl;
-        assert(surface != nullptr);
-        return;
-    }
-
-    // Retrieve the size of the text.
+    SDL_Surface* surface = nullptr;
     int32_t font_width = 0, font_height = 0;
-    if (TTF_SizeUNICODE(font_properties->ttf_font, text, &font_width, &font_height) != 0) {
-        IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_SizeUNICODE() failed" << std::endl;
-        SDL_FreeSurface(surface);
-        assert(false);
-        return;
+    {
+        MutexLock font_lock(_font_mutex);
+
+        // Render the text.
+        const SDL_Color white = { 255, 255, 255, 255 };
+        surface = TTF_RenderUNICODE_Blended(font_properties->ttf_font, text, white);
+        if (surface == nullptr) {
+            IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_RenderUNICODE_Blended() failed" << std::endl;
+            assert(surface != nullptr);
+            return;
+        }
+
+        // Retrieve the size of the text.
+        if (TTF_SizeUNICODE(font_properties->ttf_font, text, &font_width, &font_height) != 0) {
+            IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_SizeUNICODE() failed" << std::endl;
+            SDL_FreeSurface(surface);
+            assert(false);
+            return;
+        }
     }
 
     // Enable texturing.
@@ -1281,12 +1462,22 @@ bool TextSupervisor::_RenderText(const vt_utils::ustring& text, TextStyle& style
         return false;
     }
 
+    return _RenderText(text, font_properties, buffer);
+}
+
+bool TextSupervisor::_RenderText(const vt_utils::ustring& text, FontProperties* font_properties, ImageMemory& buffer)
+{
+    MutexLock font_lock(_font_mutex);
+
+    // The font may have been cleared since the text was requested.
+    if (font_properties == nullptr || font_properties->ttf_font == nullptr)
+        return false;
+
     // Render the text.
     const SDL_Color white = { 255, 255, 255, 255 };
     SDL_Surface* surface = TTF_RenderUNICODE_Blended(font_properties->ttf_font, text.c_str(), white);
     if (surface == nullptr) {
         IF_PRINT_WARNING(VIDEO_DEBUG) << "call to TTF_RenderUNICODE_Blended() failed" << std::endl;
-        assert(surface != nullptr);
         return false;
     }
 
@@ -1300,4 +1491,124 @@ bool TextSupervisor::_RenderText(const vt_utils::ustring& text, TextStyle& style
     return true;
 }
 
+uint32_t TextSupervisor::_RequestTextRendering(const std::vector<vt_utils::ustring>& lines, FontProperties* font_properties)
+{
+    if (_rendering_thread == nullptr)
+        return 0;
+
+    TextRenderingRequest* request = new TextRenderingRequest();
+    request->font_properties = font_properties;
+    request->lines = lines;
+
+    MutexLock requests_lock(_requests_mutex);
+    request->id = _next_request_id++;
+    // Never give the 0 id, even when wrapping around.
+    if (_next_request_id == 0)
+        _next_request_id = 1;
+
+    _pending_requests.push_back(request);
+    SDL_CondSignal(_requests_condition);
+    return request->id;
+}
+
+TextRenderingRequest* TextSupervisor::_RetrieveRenderedText(uint32_t request_id)
+{
+    MutexLock requests_lock(_requests_mutex);
+    std::map<uint32_t, TextRenderingRequest*>::iterator it = _rendered_requests.find(request_id);
+    if (it == _rendered_requests.end())
+        return nullptr;
+
+    TextRenderingRequest* request = it->second;
+    _rendered_requests.erase(it);
+    return request;
+}
+
+void TextSupervisor::_CancelTextRendering(uint32_t request_id)
+{
+    MutexLock requests_lock(_requests_mutex);
+
+    // The rendering thread will drop the result.
+    if (_processed_request == request_id) {
+        _processed_request_cancelled = true;
+        return;
+    }
+
+    for (std::deque<TextRenderingRequest*>::iterator it = _pending_requests.begin(); it != _pending_requests.end(); ++it) {
+        if ((*it)->id == request_id) {
+            delete *it;
+            _pending_requests.erase(it);
+            return;
+        }
+    }
+
+    std::map<uint32_t, TextRenderingRequest*>::iterator it = _rendered_requests.find(request_id);
+    if (it != _rendered_requests.end()) {
+        delete it->second;
+        _rendered_requests.erase(it);
+    }
+}
+
+int TextSupervisor::_RenderingThread(void* text_supervisor)
+{
+    static_cast<TextSupervisor*>(text_supervisor)->_ProcessRenderingRequests();
+    return 0;
+}
+
+void TextSupervisor::_ProcessRenderingRequests()
+{
+    SDL_LockMutex(_requests_mutex);
+    while (true) {
+        while (_pending_requests.empty() && !_stop_rendering_thread)
+            SDL_CondWait(_requests_condition, _requests_mutex);
+
+        if (_stop_rendering_thread)
+            break;
+
+        TextRenderingRequest* request = _pending_requests.front();
+        _pending_requests.pop_front();
+        _processed_request = request->id;
+        _processed_request_cancelled = false;
+        SDL_UnlockMutex(_requests_mutex);
+
+        // Rasterize the lines without holding the requests mutex,
+        // so that the main thread can keep on queuing requests.
+        request->buffers.resize(request->lines.size());
+        for (uint32_t i = 0; i < request->lines.size(); ++i) {
+            const ustring& line = request->lines[i];
+            if (line.empty() || line == ustring(&NEW_LINE))
+                continue;
+            _RenderText(line, request->font_properties, request->buffers[i]);
+        }
+
+        SDL_LockMutex(_requests_mutex);
+        if (_processed_request_cancelled)
+            delete request;
+        else
+            _rendered_requests[request->id] = request;
+        _processed_request = 0;
+    }
+    SDL_UnlockMutex(_requests_mutex);
+}
+
+void TextSupervisor::_StopRenderingThread()
+{
+    if (_rendering_thread != nullptr) {
+        SDL_LockMutex(_requests_mutex);
+        _stop_rendering_thread = true;
+        SDL_CondSignal(_requests_condition);
+        SDL_UnlockMutex(_requests_mutex);
+
+        SDL_WaitThread(_rendering_thread, nullptr);
+        _rendering_thread = nullptr;
+    }
+
+    for (std::deque<TextRenderingRequest*>::iterator it = _pending_requests.begin(); it != _pending_requests.end(); ++it)
+        delete *it;
+    _pending_requests.clear();
+
+    for (std::map<uint32_t, TextRenderingRequest*>::iterator it = _rendered_requests.begin(); it != _rendered_requests.end(); ++it)
+        delete it->second;
+    _rendered_requests.clear();
+}
+
 }  // namespace vt_video
@@ -16,6 +16,10 @@
 ***
 *** This code makes use of the SDL_ttf font library for representing fonts,
 *** font glyphs, and text.
+***
+*** Text images lines are rasterized on a dedicated thread, and uploaded
+*** on the main thread once ready. As SDL_ttf fonts can't be used by several
+*** threads at once, every SDL_ttf call is protected by the font mutex.
 *** ***************************************************************************/
 
 #ifndef __TEXT_HEADER__
@@ -247,6 +251,9 @@ public:
     //! \brief Generate a text texture and add to a texture sheet
     bool Regenerate();
 
+    //! \brief Adds the already rendered text pixels to a texture sheet
+    bool Regenerate(ImageMemory& buffer);
+
     //! \brief Reload texture to an already assigned texture sheet
     bool Reload();
 
@@ -325,6 +332,34 @@ private:
     {}
 };
 
+/** ****************************************************************************
+*** \brief The lines of a text image to rasterize on the text rendering thread.
+***
+*** The request is created on the main thread, the buffers are filled
+*** on the text rendering thread, and the request is then handed back
+*** to the main thread, which uploads the buffers into text textures.
+*** ***************************************************************************/
+class TextRenderingRequest
+{
+public:
+    TextRenderingRequest():
+        id(0),
+        font_properties(nullptr)
+    {}
+
+    //! \brief The unique request id. 0 is never used.
+    uint32_t id;
+
+    //! \brief The font the lines are rendered with.
+    FontProperties* font_properties;
+
+    //! \brief The wrapped lines to render.
+    std::vector<vt_utils::ustring> lines;
+
+    //! \brief The rendered lines pixels. Empty lines have empty buffers.
+    std::vector<ImageMemory> buffers;
+};
+
 } // namespace private_video
 
 /** ****************************************************************************
@@ -403,6 +438,8 @@ public:
 
     //! \brief Sets the text contained
     void SetText(const vt_utils::ustring &text) {
+        _message_id.clear();
+
         // Don't do anything if it's the same text
         if (_text == text)
             return;
@@ -412,6 +449,7 @@ public:
     }
 
     void SetText(const vt_utils::ustring &text, const TextStyle& text_style) {
+        _message_id.clear();
         _text = text;
         _style = text_style;
         _Regenerate();
@@ -432,6 +470,12 @@ public:
         SetText(vt_utils::MakeUnicodeString(text), text_style);
     }
 
+    /** \brief Sets the text from a message id, translated in the current language.
+    *** The text is translated and rendered again on its next draw whenever
+    *** the language changes, so it never has to be set up again.
+    **/
+    void SetTranslatableText(const std::string &message_id);
+
     void SetWordWrapWidth(uint32_t width) {
         _max_width = width;
     }
@@ -459,6 +503,12 @@ private:
     //! \brief The unicode string of the text to render
     vt_utils::ustring _text;
 
+    //! \brief The message id the text is translated from, or empty when the text isn't translatable.
+    std::string _message_id;
+
+    //! \brief The system locale generation the text was last translated with.
+    uint32_t _locale_generation;
+
     //! \brief The style to render the text in
     TextStyle _style;
 
@@ -468,11 +518,36 @@ private:
     //! \brief The TextTexture elements representing rendered text portions, usually lines.
     std::vector<private_video::TextElement *> _text_sections;
 
+    //! \brief The id of the text rendering request pending for this text, or 0 when there is none.
+    //! The previous text sections are drawn until the request is complete.
+    uint32_t _rendering_request;
+
     // ---------- Private methods
 
-    //! \brief Regenerates the texture images for the text
+    /** \brief Regenerates the texture images for the text
+    *** The text dimensions are updated right away, while the lines are rendered
+    *** on the text rendering thread when it is available.
+    **/
     void _Regenerate();
 
+    //! \brief Replaces the text sections with the new lines once their rendering is complete.
+    void _UpdateRendering();
+
+    //! \brief Cancels the pending text rendering request, if any.
+    void _CancelRendering();
+
+    /** \brief Replaces the text sections with the given lines.
+    *** \param lines The wrapped lines of text.
+    *** \param buffers The lines rendered pixels, or nullptr to render them right away.
+    *** \param font_properties The font the lines are rendered with.
+    **/
+    void _SetTextSections(const std::vector<vt_utils::ustring>& lines,
+                          std::vector<private_video::ImageMemory>* buffers,
+                          FontProperties* font_properties);
+
+    //! \brief Translates and regenerates the text again if the language changed since it was last translated.
+    void _UpdateTranslation();
+
     //! \brief Dervied from ImageDescriptor, this method is not used by TextImage
     void _EnableGrayscale()
     {}
@@ -599,6 +674,39 @@ private:
     //! \brief The default text style
     TextStyle _default_style;
 
+    //! \brief Protects every SDL_ttf call, as SDL_ttf fonts can't be used by several threads at once.
+    SDL_mutex* _font_mutex;
+
+    //! \name Text rendering thread members
+    //@{
+    //! \brief The thread rasterizing the text images lines, or nullptr when they are rendered synchronously.
+    SDL_Thread* _rendering_thread;
+
+    //! \brief Protects the rendering requests members below.
+    SDL_mutex* _requests_mutex;
+
+    //! \brief Signaled when a request is queued or when the rendering thread must stop.
+    SDL_cond* _requests_condition;
+
+    //! \brief The requests waiting to be rendered, in order.
+    std::deque<private_video::TextRenderingRequest *> _pending_requests;
+
+    //! \brief The rendered requests waiting to be retrieved by their text image, sorted by id.
+    std::map<uint32_t, private_video::TextRenderingRequest *> _rendered_requests;
+
+    //! \brief The id of the request currently rendered, or 0.
+    uint32_t _processed_request;
+
+    //! \brief Whether the request currently rendered was cancelled in the meantime.
+    bool _processed_request_cancelled;
+
+    //! \brief The id given to the next request.
+    uint32_t _next_request_id;
+
+    //! \brief Tells the rendering thread to stop.
+    bool _stop_rendering_thread;
+    //@}
+
     /** \brief A container for properties for each font which has been loaded
     *** The key to the map is the font name.
     **/
@@ -655,6 +763,32 @@ private:
     **/
     bool _RenderText(const vt_utils::ustring& text, TextStyle& style, private_video::ImageMemory& buffer);
 
+    //! \brief Renders a unicode string to a pixel array using the given font properties.
+    //! \note This method can be called from the text rendering thread.
+    bool _RenderText(const vt_utils::ustring& text, FontProperties* font_properties, private_video::ImageMemory& buffer);
+
+    /** \brief Queues the given lines to be rendered on the text rendering thread.
+    *** \return The request id, or 0 if the lines must be rendered synchronously.
+    **/
+    uint32_t _RequestTextRendering(const std::vector<vt_utils::ustring>& lines, FontProperties* font_properties);
+
+    /** \brief Returns the given request if its rendering is complete, or nullptr otherwise.
+    *** \note The caller takes ownership of the returned request.
+    **/
+    private_video::TextRenderingRequest* _RetrieveRenderedText(uint32_t request_id);
+
+    //! \brief Cancels the given request, whether it is pending, being rendered or already rendered.
+    void _CancelTextRendering(uint32_t request_id);
+
+    //! \brief The text rendering thread entry point.
+    static int _RenderingThread(void* text_supervisor);
+
+    //! \brief Renders the queued requests until the rendering thread is told to stop.
+    void _ProcessRenderingRequests();
+
+    //! \brief Stops the rendering thread and frees the remaining requests.
+    void _StopRenderingThread();
+
     /** \brief Returns true if a font of a certain reference name exists
     *** \param font_name The reference name of the font to check
     *** \return True if font name is valid, false if it is not.
@@ -388,6 +388,16 @@ uint32_t FixedTexSheet::GetNumberTextures()
 
 
 
+void FixedTexSheet::GetTextures(std::vector<BaseTexture *> &textures)
+{
+    for(int32_t i = 0; i < _block_width * _block_height; i++) {
+        if(_blocks[i].image != nullptr)
+            textures.push_back(_blocks[i].image);
+    }
+}
+
+
+
 int32_t FixedTexSheet::_CalculateBlockIndex(BaseTexture *img)
 {
     int32_t block_x = img->x / _texture_width;
@@ -563,6 +573,20 @@ void VariableTexSheet::RemoveTexture(BaseTexture *img)
 
 
 
+uint32_t VariableTexSheet::GetUsedArea()
+{
+    uint32_t num_blocks = 0;
+
+    for(int32_t i = 0; i < _block_width * _block_height; i++) {
+        if(_blocks[i].free_image == false)
+            num_blocks++;
+    }
+
+    return num_blocks * 16 * 16;
+}
+
+
+
 void VariableTexSheet::_SetBlockProperties(BaseTexture *tex, BaseTexture *new_tex, bool free)
 {
     if(tex == nullptr) {
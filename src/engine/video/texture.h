@@ -142,6 +142,14 @@ public:
     //! \brief Returns the number of textures that are contained on this texture sheet
     virtual uint32_t GetNumberTextures() = 0;
 
+    /** \brief Appends the textures contained on this texture sheet to the given vector
+    *** \param textures The vector to append the textures to
+    **/
+    virtual void GetTextures(std::vector<BaseTexture *> &textures) = 0;
+
+    //! \brief Returns the number of pixels occupied by textures, including the unused parts of their blocks
+    virtual uint32_t GetUsedArea() = 0;
+
     /** \brief Unloads all texture memory used by OpenGL for this sheet
     *** \return Success/failure
     **/
@@ -300,6 +308,12 @@ public:
     void RestoreTexture(BaseTexture *img);
 
     uint32_t GetNumberTextures();
+
+    void GetTextures(std::vector<BaseTexture *> &textures);
+
+    uint32_t GetUsedArea() {
+        return GetNumberTextures() * _texture_width * _texture_height;
+    }
     //@}
 
 private:
@@ -395,6 +409,12 @@ public:
     uint32_t GetNumberTextures() {
         return _textures.size();
     }
+
+    void GetTextures(std::vector<BaseTexture *> &textures) {
+        textures.insert(textures.end(), _textures.begin(), _textures.end());
+    }
+
+    uint32_t GetUsedArea();
     //@}
 
 private:
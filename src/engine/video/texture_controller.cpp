@@ -31,7 +31,8 @@ namespace vt_video
 TextureController* TextureManager = nullptr;
 
 TextureController::TextureController() :
-    _debug_current_sheet(-1)
+    _debug_current_sheet(-1),
+    _layout_version(0)
 {
 }
 
@@ -173,6 +174,65 @@ void TextureController::DEBUG_ShowTexSheet()
     VideoManager->PopState();
 }
 
+uint32_t TextureController::DefragmentTexSheets()
+{
+    TexSheetStats previous_stats = GetTexSheetStats();
+
+    // The previous sheets are read through a framebuffer to copy their pixels.
+    GLuint framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    if(VideoManager->CheckGLError()) {
+        IF_PRINT_WARNING(VIDEO_DEBUG) << "could not create the framebuffer: " << VideoManager->CreateGLErrorString() << std::endl;
+        return 0;
+    }
+
+    GLint previous_framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    bool moved = false;
+    for(int32_t type = VIDEO_TEXSHEET_32x32; type < VIDEO_TEXSHEET_TOTAL; ++type) {
+        if(_RepackTexSheets(static_cast<TexSheetType>(type), false))
+            moved = true;
+        if(_RepackTexSheets(static_cast<TexSheetType>(type), true))
+            moved = true;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_framebuffer));
+    glDeleteFramebuffers(1, &framebuffer);
+
+    if(!moved)
+        return 0;
+
+    // Makes the image batches know they must be rebuilt.
+    ++_layout_version;
+
+    TexSheetStats stats = GetTexSheetStats();
+    IF_PRINT_DEBUG(VIDEO_DEBUG) << "Texture sheets repacked: "
+                                << previous_stats.number_sheets << " sheets ("
+                                << static_cast<int32_t>(previous_stats.GetOccupancy() * 100.0f) << "% used) -> "
+                                << stats.number_sheets << " sheets ("
+                                << static_cast<int32_t>(stats.GetOccupancy() * 100.0f) << "% used), "
+                                << stats.number_textures << " textures" << std::endl;
+
+    if(stats.number_sheets >= previous_stats.number_sheets)
+        return 0;
+    return previous_stats.number_sheets - stats.number_sheets;
+}
+
+TexSheetStats TextureController::GetTexSheetStats()
+{
+    TexSheetStats stats;
+    for(uint32_t i = 0; i < _tex_sheets.size(); ++i) {
+        TexSheet *sheet = _tex_sheets[i];
+        ++stats.number_sheets;
+        stats.number_textures += sheet->GetNumberTextures();
+        stats.used_area += sheet->GetUsedArea();
+        stats.total_area += static_cast<uint64_t>(sheet->width) * sheet->height;
+    }
+    return stats;
+}
+
 GLuint TextureController::_CreateBlankGLTexture(int32_t width, int32_t height)
 {
     GLuint tex_id;
@@ -455,6 +515,121 @@ bool TextureController::_ReloadImagesToSheet(TexSheet *sheet)
 
 
 
+//! \brief Sorts textures by decreasing height, to pack the variable sized sheets rows tightly.
+static bool IsTallerTexture(const BaseTexture *first, const BaseTexture *second)
+{
+    return first->height > second->height;
+}
+
+bool TextureController::_IsRepackableTexSheet(TexSheet *sheet) const
+{
+    // The shared sheets are the only ones created with the default size.
+    return (sheet->loaded && sheet->width == 512 && sheet->height == 512);
+}
+
+bool TextureController::_RepackTexSheets(TexSheetType type, bool is_static)
+{
+    std::vector<TexSheet *> previous_sheets;
+    for(uint32_t i = 0; i < _tex_sheets.size(); ++i) {
+        TexSheet *sheet = _tex_sheets[i];
+        if(sheet->type == type && sheet->is_static == is_static && _IsRepackableTexSheet(sheet))
+            previous_sheets.push_back(sheet);
+    }
+
+    // A single sheet can't be packed any further.
+    if(previous_sheets.size() < 2)
+        return false;
+
+    // Don't move anything when the textures couldn't fit in fewer sheets anyway.
+    uint64_t used_area = 0;
+    std::vector<BaseTexture *> textures;
+    for(uint32_t i = 0; i < previous_sheets.size(); ++i) {
+        used_area += previous_sheets[i]->GetUsedArea();
+        previous_sheets[i]->GetTextures(textures);
+    }
+    if(used_area > static_cast<uint64_t>(previous_sheets.size() - 1) * 512 * 512)
+        return false;
+
+    std::stable_sort(textures.begin(), textures.end(), IsTallerTexture);
+
+    std::vector<TexSheet *> new_sheets;
+    bool moved = false;
+    for(uint32_t i = 0; i < textures.size(); ++i) {
+        BaseTexture *texture = textures[i];
+        TexSheet *previous_sheet = texture->texture_sheet;
+        const int32_t previous_x = texture->x;
+        const int32_t previous_y = texture->y;
+        // Captured screens are stored upside down.
+        const bool flipped = texture->v1 > texture->v2;
+
+        TexSheet *new_sheet = nullptr;
+        for(uint32_t j = 0; j < new_sheets.size() && new_sheet == nullptr; ++j) {
+            if(new_sheets[j]->InsertTexture(texture))
+                new_sheet = new_sheets[j];
+        }
+
+        if(new_sheet == nullptr) {
+            new_sheet = _CreateTexSheet(512, 512, type, is_static);
+            if(new_sheet == nullptr) {
+                // The remaining textures simply stay in their previous sheets.
+                IF_PRINT_WARNING(VIDEO_DEBUG) << "could not create a new texture sheet, stopped repacking" << std::endl;
+                break;
+            }
+            new_sheets.push_back(new_sheet);
+
+            if(new_sheet->InsertTexture(texture) == false) {
+                IF_PRINT_WARNING(VIDEO_DEBUG) << "could not insert a texture in an empty texture sheet" << std::endl;
+                break;
+            }
+        }
+
+        if(flipped)
+            std::swap(texture->v1, texture->v2);
+
+        // Release the previous location, found using the previous texture position.
+        const int32_t new_x = texture->x;
+        const int32_t new_y = texture->y;
+        texture->x = previous_x;
+        texture->y = previous_y;
+        previous_sheet->RemoveTexture(texture);
+        texture->x = new_x;
+        texture->y = new_y;
+
+        if(_CopyTexturePixels(previous_sheet, previous_x, previous_y, texture) == false)
+            IF_PRINT_WARNING(VIDEO_DEBUG) << "failed to copy a texture to its new texture sheet" << std::endl;
+        moved = true;
+    }
+
+    // Delete the previous sheets left empty.
+    for(uint32_t i = 0; i < previous_sheets.size(); ++i) {
+        if(previous_sheets[i]->GetNumberTextures() == 0)
+            _RemoveSheet(previous_sheets[i]);
+    }
+
+    return moved;
+}
+
+bool TextureController::_CopyTexturePixels(TexSheet *source, int32_t x, int32_t y, BaseTexture *texture)
+{
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, source->tex_id, 0);
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        IF_PRINT_WARNING(VIDEO_DEBUG) << "the texture sheet couldn't be attached to the framebuffer" << std::endl;
+        return false;
+    }
+
+    _BindTexture(texture->texture_sheet->tex_id);
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, texture->x, texture->y, x, y, texture->width, texture->height);
+
+    if(VideoManager->CheckGLError()) {
+        IF_PRINT_WARNING(VIDEO_DEBUG) << "an OpenGL error occured: " << VideoManager->CreateGLErrorString() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+
 void TextureController::_RegisterImageTexture(ImageTexture *img)
 {
     if(img == nullptr) {
@@ -38,12 +38,38 @@ namespace private_video {
 class TextTexture;
 }
 
+//! \brief Occupancy statistics of the texture sheets
+class TexSheetStats
+{
+public:
+    TexSheetStats() :
+        number_sheets(0),
+        number_textures(0),
+        used_area(0),
+        total_area(0)
+    {}
+
+    //! \brief The number of texture sheets and of textures they contain
+    uint32_t number_sheets;
+    uint32_t number_textures;
+
+    //! \brief The number of pixels occupied by textures, and the number of pixels of all the sheets
+    uint64_t used_area;
+    uint64_t total_area;
+
+    //! \brief Returns the occupied part of the texture sheets, between [0.0, 1.0]
+    float GetOccupancy() const {
+        return total_area == 0 ? 0.0f : static_cast<float>(used_area) / static_cast<float>(total_area);
+    }
+};
+
 class TextureController : public vt_utils::Singleton<TextureController>
 {
     friend class vt_utils::Singleton<TextureController>;
     friend class VideoEngine;
     friend class private_video::ImageMemory;
     friend class ImageDescriptor;
+    friend class ImageBatch;
     friend class StillImage;
     friend class private_video::ImageTexture;
     friend class private_video::TextTexture;
@@ -71,6 +97,27 @@ public:
     **/
     void DEBUG_ShowTexSheet();
 
+    /** \brief Repacks the images of the shared texture sheets into as few sheets as possible
+    *** \return The number of texture sheets freed
+    ***
+    *** As images get loaded and unloaded, the shared texture sheets get holes and new images
+    *** may spill into new sheets, increasing the number of texture switches when drawing.
+    *** Images of the same sheet type are moved from sheet to sheet on the GPU: their texture
+    *** objects are kept and only their sheet, position and uv coordinates are updated.
+    ***
+    *** \note This should only be called at safe points, such as game mode changes,
+    *** since it stalls the rendering and makes the image batches built beforehand outdated.
+    **/
+    uint32_t DefragmentTexSheets();
+
+    //! \brief Returns the occupancy statistics of all the texture sheets.
+    TexSheetStats GetTexSheetStats();
+
+    //! \brief Returns a number changed each time images are moved between texture sheets.
+    uint32_t GetTexSheetsLayoutVersion() const {
+        return _layout_version;
+    }
+
 private:
     virtual ~TextureController() override;
 
@@ -86,6 +133,9 @@ private:
     //! \brief An index to _tex_sheets of the current texture sheet being shown in debug mode. -1 indicates no sheet
     int32_t _debug_current_sheet;
 
+    //! \brief Incremented each time images are moved between texture sheets
+    uint32_t _layout_version;
+
     // ---------- Private methods
 
     //! \name Texture Operations
@@ -142,6 +192,27 @@ private:
     *** \return True only if every single image owned by the TexSheet was successfully reloaded back into it
     **/
     bool _ReloadImagesToSheet(private_video::TexSheet *sheet);
+
+    /** \brief Tells whether a texture sheet can be repacked with the others of its type
+    *** Unloaded sheets and sheets dedicated to a single large image or capture are never repacked.
+    **/
+    bool _IsRepackableTexSheet(private_video::TexSheet *sheet) const;
+
+    /** \brief Moves the textures of all the repackable sheets of a type into as few new sheets as possible
+    *** \param type The type of the sheets to repack
+    *** \param is_static The static status of the sheets to repack
+    *** \return True if any texture was moved
+    *** The framebuffer used to read the previous sheets pixels must be bound.
+    **/
+    bool _RepackTexSheets(private_video::TexSheetType type, bool is_static);
+
+    /** \brief Copies the pixels of a texture from its previous location to its current one
+    *** \param source The sheet where the texture was located
+    *** \param x, y The previous texture location in the source sheet
+    *** \param texture The texture, already inserted in its new sheet
+    *** \return Success/failure
+    **/
+    bool _CopyTexturePixels(private_video::TexSheet *source, int32_t x, int32_t y, private_video::BaseTexture *texture);
     //@}
 
     //! \name Image Texture Operations
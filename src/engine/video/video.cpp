@@ -104,6 +104,14 @@ VideoEngine::VideoEngine():
     _temp_height(0),
     _vsync_mode(0),
     _game_update_mode(false),
+    _adaptive_quality(true),
+    _quality_level(0),
+    _internal_width(VIDEO_STANDARD_RES_WIDTH),
+    _internal_height(VIDEO_STANDARD_RES_HEIGHT),
+    _scale_filter(VIDEO_SCALE_FILTER_SHARP_BILINEAR),
+    _average_frame_time(0.0f),
+    _quality_budget_time(0),
+    _frame_time_budget(1000.0f / 60.0f),
     _sprite(nullptr),
     _particle_system(nullptr),
     _initialized(false)
@@ -169,6 +177,8 @@ VideoEngine::~VideoEngine()
     }
 
     TextManager->SingletonDestroy();
+    // Text images freed from now on must not cancel their rendering requests anymore.
+    TextManager = nullptr;
 
     _rectangle_image.Clear();
 
@@ -210,6 +220,7 @@ bool VideoEngine::FinalizeInitialization()
     gl::Shader* solid_color_grayscale_fragment = new gl::Shader(GL_FRAGMENT_SHADER, gl::shader_definitions::SOLID_GRAYSCALE_FRAGMENT);
     gl::Shader* sprite_fragment                = new gl::Shader(GL_FRAGMENT_SHADER, gl::shader_definitions::SPRITE_FRAGMENT);
     gl::Shader* sprite_grayscale_fragment      = new gl::Shader(GL_FRAGMENT_SHADER, gl::shader_definitions::SPRITE_GRAYSCALE_FRAGMENT);
+    gl::Shader* sprite_sharp_bilinear_fragment = new gl::Shader(GL_FRAGMENT_SHADER, gl::shader_definitions::SPRITE_SHARP_BILINEAR_FRAGMENT);
 
     // Store the shaders.
     _shaders[gl::shaders::VertexDefault] = default_vertex;
@@ -217,6 +228,7 @@ bool VideoEngine::FinalizeInitialization()
     _shaders[gl::shaders::FragmentSolidGrayscale] = solid_color_grayscale_fragment;
     _shaders[gl::shaders::FragmentSprite] = sprite_fragment;
     _shaders[gl::shaders::FragmentSpriteGrayscale] = sprite_grayscale_fragment;
+    _shaders[gl::shaders::FragmentSpriteSharpBilinear] = sprite_sharp_bilinear_fragment;
 
     //
     // Create the shader programs.
@@ -243,6 +255,10 @@ bool VideoEngine::FinalizeInitialization()
                                                                         _shaders[gl::shaders::FragmentSpriteGrayscale],
                                                                         attributes);
 
+    gl::ShaderProgram* sprite_sharp_bilinear_program = new gl::ShaderProgram(_shaders[gl::shaders::VertexDefault],
+                                                                             _shaders[gl::shaders::FragmentSpriteSharpBilinear],
+                                                                             attributes);
+
     //
     // Store the shader programs.
     //
@@ -251,6 +267,7 @@ bool VideoEngine::FinalizeInitialization()
     _programs[gl::shader_programs::SolidGrayscale] = solid_grayscale_program;
     _programs[gl::shader_programs::Sprite] = sprite_program;
     _programs[gl::shader_programs::SpriteGrayscale] = sprite_grayscale_program;
+    _programs[gl::shader_programs::SpriteSharpBilinear] = sprite_sharp_bilinear_program;
 
     // Create instances of the various sub-systems
     TextureManager = TextureController::SingletonCreate();
@@ -364,6 +381,22 @@ void VideoEngine::Update()
 
     if (_fps_display)
         _UpdateFPS();
+
+    if (_adaptive_quality)
+        _UpdateQualityGovernor(frame_time);
+}
+
+void VideoEngine::SetAdaptiveQuality(bool adaptive_quality)
+{
+    _adaptive_quality = adaptive_quality;
+
+    // Restore the full quality when disabling the governor.
+    if (!_adaptive_quality && _quality_level > 0) {
+        _quality_level = 0;
+        PRINT_WARNING << "Adaptive quality disabled: restoring full quality." << std::endl;
+    }
+    _average_frame_time = 0.0f;
+    _quality_budget_time = 0;
 }
 
 void VideoEngine::DrawDebugInfo()
@@ -403,6 +436,37 @@ void VideoEngine::GetPixelSize(float &x, float &y)
     y = fabs(_current_context.coordinate_system.GetTop() - _current_context.coordinate_system.GetBottom()) / _viewport_height;
 }
 
+void VideoEngine::GetSecondaryRenderTargetPixelSize(float &x, float &y) const
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    _GetSecondaryRenderTargetSize(width, height);
+
+    x = fabs(_current_context.coordinate_system.GetRight() - _current_context.coordinate_system.GetLeft()) / width;
+    y = fabs(_current_context.coordinate_system.GetTop() - _current_context.coordinate_system.GetBottom()) / height;
+}
+
+void VideoEngine::SetInternalResolution(uint32_t width, uint32_t height)
+{
+    if (width == 0 || height == 0) {
+        PRINT_WARNING << "Invalid internal resolution: " << width << " x " << height << std::endl;
+        return;
+    }
+
+    _internal_width = width;
+    _internal_height = height;
+}
+
+void VideoEngine::SetScaleFilter(VIDEO_SCALE_FILTER scale_filter)
+{
+    if (scale_filter < VIDEO_SCALE_FILTER_NEAREST || scale_filter >= VIDEO_SCALE_FILTER_TOTAL) {
+        PRINT_WARNING << "Invalid scale filter: " << scale_filter << std::endl;
+        return;
+    }
+
+    _scale_filter = scale_filter;
+}
+
 bool VideoEngine::ApplySettings()
 {
     if (!_sdl_window) {
@@ -459,10 +523,6 @@ bool VideoEngine::ApplySettings()
 
     _UpdateViewportMetrics();
 
-    // Resize the secondary render target.
-    assert(_secondary_render_target != nullptr);
-    _secondary_render_target->Resize(_screen_width, _screen_height);
-
     // Try to apply the VSync mode
     if (_vsync_mode > 2) {
         _vsync_mode = 0;
@@ -485,6 +545,15 @@ bool VideoEngine::ApplySettings()
         SDL_GL_SetSwapInterval(0);
     }
 
+    // The quality governor aims at the display refresh rate, which is also the VSync interval.
+    SDL_DisplayMode display_mode;
+    if (SDL_GetWindowDisplayMode(_sdl_window, &display_mode) == 0 && display_mode.refresh_rate > 0)
+        _frame_time_budget = 1000.0f / static_cast<float>(display_mode.refresh_rate);
+    else
+        _frame_time_budget = 1000.0f / 60.0f;
+    _average_frame_time = 0.0f;
+    _quality_budget_time = 0;
+
     return true;
 }
 
@@ -598,12 +667,27 @@ void VideoEngine::DisableTexture2D()
 void VideoEngine::EnableSecondaryRenderTarget()
 {
     assert(_secondary_render_target != nullptr);
+
+    // Resize the render target only when the internal resolution, the viewport
+    // or the quality level actually changed.
+    uint32_t width = 0;
+    uint32_t height = 0;
+    _GetSecondaryRenderTargetSize(width, height);
+    if (width != _secondary_render_target->GetWidth() || height != _secondary_render_target->GetHeight())
+        _secondary_render_target->Resize(width, height);
+
     _secondary_render_target->Bind();
+    SetViewport(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height));
 }
 
 void VideoEngine::DisableSecondaryRenderTarget()
 {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    SetViewport(_current_context.viewport.left,
+                _current_context.viewport.top,
+                _current_context.viewport.width,
+                _current_context.viewport.height);
 }
 
 void VideoEngine::DrawSecondaryRenderTarget()
@@ -611,13 +695,34 @@ void VideoEngine::DrawSecondaryRenderTarget()
     assert(_sprite != nullptr);
     assert(_secondary_render_target != nullptr);
 
+    // Disable the secondary render target.
+    DisableSecondaryRenderTarget();
+
     float width_render_target = static_cast<float>(_secondary_render_target->GetWidth());
     float height_render_target = static_cast<float>(_secondary_render_target->GetHeight());
 
+    // The render target is scaled onto the current viewport.
+    float x_destination = static_cast<float>(_current_context.viewport.left);
+    float y_destination = static_cast<float>(_current_context.viewport.top);
+    float width_destination = static_cast<float>(_current_context.viewport.width);
+    float height_destination = static_cast<float>(_current_context.viewport.height);
+
+    if (_scale_filter == VIDEO_SCALE_FILTER_INTEGER) {
+        float scale = floorf(std::min(width_destination / width_render_target,
+                                      height_destination / height_render_target));
+        // When the render target doesn't fit at all, it is simply stretched.
+        if (scale >= 1.0f) {
+            x_destination += floorf((width_destination - width_render_target * scale) / 2.0f);
+            y_destination += floorf((height_destination - height_render_target * scale) / 2.0f);
+            width_destination = width_render_target * scale;
+            height_destination = height_render_target * scale;
+        }
+    }
+
     // Set up the video manager state.
     vt_video::VideoManager->PushState();
 
-    vt_video::VideoManager->SetViewport(0.0f, 0.0f, width_render_target, height_render_target);
+    vt_video::VideoManager->SetViewport(x_destination, y_destination, width_destination, height_destination);
     vt_video::VideoManager->SetCoordSys(0.0f, width_render_target, height_render_target, 0.0f);
     vt_video::VideoManager->SetDrawFlags(vt_video::VIDEO_X_LEFT, vt_video::VIDEO_Y_TOP, vt_video::VIDEO_BLEND, 0);
 
@@ -625,7 +730,23 @@ void VideoEngine::DrawSecondaryRenderTarget()
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     // Load the shader program.
-    gl::ShaderProgram* shader_program = VideoManager->LoadShaderProgram(gl::shader_programs::Sprite);
+    gl::ShaderProgram* shader_program = nullptr;
+    if (_scale_filter == VIDEO_SCALE_FILTER_SHARP_BILINEAR) {
+        shader_program = VideoManager->LoadShaderProgram(gl::shader_programs::SpriteSharpBilinear);
+        assert(shader_program != nullptr);
+
+        // The texture size and the integer prescale factors.
+        const float scale_parameters[] = {
+            width_render_target,
+            height_render_target,
+            std::max(1.0f, floorf(width_destination / width_render_target)),
+            std::max(1.0f, floorf(height_destination / height_render_target))
+        };
+        shader_program->UpdateUniform("u_ScaleParameters", scale_parameters, 4);
+    }
+    else {
+        shader_program = VideoManager->LoadShaderProgram(gl::shader_programs::Sprite);
+    }
     assert(shader_program != nullptr);
 
     // Load the shader uniforms.
@@ -642,12 +763,14 @@ void VideoEngine::DrawSecondaryRenderTarget()
 
     shader_program->UpdateUniform("u_Color", ::vt_video::Color::white.GetColors(), 4);
 
-    // Disable the secondary render target.
-    DisableSecondaryRenderTarget();
-
     // Bind the secondary render target's texture.
     _secondary_render_target->BindTexture();
 
+    // The sharp bilinear shader needs the linear filter to blend the texels edges.
+    GLint filter = (_scale_filter == VIDEO_SCALE_FILTER_SHARP_BILINEAR) ? GL_LINEAR : GL_NEAREST;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+
     //
     // Draw a fullscreen quad.
     //
@@ -1266,6 +1389,20 @@ void VideoEngine::_UpdateViewportMetrics()
     _current_context.viewport.height = _viewport_height;
 }
 
+void VideoEngine::_GetSecondaryRenderTargetSize(uint32_t &width, uint32_t &height) const
+{
+    // Never draw more pixels than the ones actually displayed.
+    float scale = std::min(static_cast<float>(_current_context.viewport.width) / _internal_width,
+                           static_cast<float>(_current_context.viewport.height) / _internal_height);
+    scale = std::min(scale, 1.0f);
+
+    // Lower the resolution along with the adaptive quality.
+    scale *= 1.0f - static_cast<float>(_quality_level) * VIDEO_QUALITY_RESOLUTION_STEP;
+
+    width = std::max(static_cast<uint32_t>(_internal_width * scale), 1u);
+    height = std::max(static_cast<uint32_t>(_internal_height * scale), 1u);
+}
+
 void VideoEngine::_UpdateFPS()
 {
     if (!_fps_display)
@@ -1330,6 +1467,58 @@ void VideoEngine::_UpdateFPS()
     _FPS_textimage->SetText("FPS: " + NumberToString(avg_fps));
 }
 
+void VideoEngine::_UpdateQualityGovernor(uint32_t frame_time)
+{
+    //! \brief Over this smoothed frame time, the quality is considered too high (about 40 FPS at 60 Hz).
+    const float OVER_BUDGET_FRAME_TIME = _frame_time_budget * 1.5f;
+    //! \brief Under this smoothed frame time, there is enough headroom to raise the quality (about 52 FPS at 60 Hz).
+    const float HEADROOM_FRAME_TIME = _frame_time_budget * 1.15f;
+    //! \brief Frames taking longer than this are loading hitches and are ignored.
+    const uint32_t MAX_SAMPLED_FRAME_TIME = 250;
+    //! \brief How long the frame time must be over budget before lowering the quality.
+    const int32_t LOWER_QUALITY_DELAY = 3000;
+    //! \brief How long there must be headroom before raising the quality.
+    //! Longer than the lowering delay to avoid oscillating between two levels.
+    const int32_t RAISE_QUALITY_DELAY = 10000;
+
+    if (frame_time == 0 || frame_time > MAX_SAMPLED_FRAME_TIME)
+        return;
+
+    // Exponential moving average over roughly the last 30 frames.
+    if (_average_frame_time <= 0.0f)
+        _average_frame_time = static_cast<float>(frame_time);
+    else
+        _average_frame_time += (static_cast<float>(frame_time) - _average_frame_time) / 30.0f;
+
+    // Only keep track of the time spent over or under budget when the quality can actually change.
+    if (_average_frame_time > OVER_BUDGET_FRAME_TIME && _quality_level + 1 < VIDEO_QUALITY_LEVELS) {
+        if (_quality_budget_time < 0)
+            _quality_budget_time = 0;
+        _quality_budget_time += frame_time;
+    }
+    else if (_average_frame_time < HEADROOM_FRAME_TIME && _quality_level > 0) {
+        if (_quality_budget_time > 0)
+            _quality_budget_time = 0;
+        _quality_budget_time -= frame_time;
+    }
+    else {
+        _quality_budget_time = 0;
+    }
+
+    if (_quality_budget_time >= LOWER_QUALITY_DELAY) {
+        ++_quality_level;
+        _quality_budget_time = 0;
+        PRINT_WARNING << "Adaptive quality: average frame time is " << _average_frame_time
+                      << " ms, lowering the quality level to " << _quality_level << std::endl;
+    }
+    else if (_quality_budget_time <= -RAISE_QUALITY_DELAY) {
+        --_quality_level;
+        _quality_budget_time = 0;
+        PRINT_WARNING << "Adaptive quality: average frame time is " << _average_frame_time
+                      << " ms, raising the quality level to " << _quality_level << std::endl;
+    }
+}
+
 void VideoEngine::_DrawFPS()
 {
     if (!_fps_display || !_FPS_textimage)
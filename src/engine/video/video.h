@@ -115,6 +115,7 @@ class VideoEngine : public vt_utils::Singleton<VideoEngine>
     friend class private_video::VariableTexSheet;
 
     friend class ImageDescriptor;
+    friend class ImageBatch;
     friend class CompositeImage;
     friend class private_video::TextElement;
     friend class TextImage;
@@ -257,6 +258,53 @@ public:
         return _game_update_mode;
     }
 
+    /** \brief Enables or disables the adaptive quality governor.
+    *** When enabled, the costly visual effects are progressively reduced when the frame time
+    *** goes over budget, and restored when there is headroom again.
+    **/
+    void SetAdaptiveQuality(bool adaptive_quality);
+
+    //! \brief Tells whether the adaptive quality governor is enabled.
+    bool IsAdaptiveQualityEnabled() const {
+        return _adaptive_quality;
+    }
+
+    //! \brief Returns the current quality level, from 0 (full quality) to VIDEO_QUALITY_LEVELS - 1.
+    uint32_t GetQualityLevel() const {
+        return _quality_level;
+    }
+
+    //! \brief Returns the factor to apply to the amount of costly effects,
+    //! from 1.0f at full quality down to 1 / VIDEO_QUALITY_LEVELS.
+    float GetQualityFactor() const {
+        return 1.0f - static_cast<float>(_quality_level) / static_cast<float>(VIDEO_QUALITY_LEVELS);
+    }
+
+    /** \brief Sets the internal resolution the secondary render target is drawn at.
+    *** The secondary render target is then scaled onto the screen with the scale filter.
+    *** \note The resolution actually used is never higher than the viewport one,
+    *** and is lowered along with the adaptive quality level.
+    **/
+    void SetInternalResolution(uint32_t width, uint32_t height);
+
+    //! \brief Gets the requested internal resolution width.
+    uint32_t GetInternalWidth() const {
+        return _internal_width;
+    }
+
+    //! \brief Gets the requested internal resolution height.
+    uint32_t GetInternalHeight() const {
+        return _internal_height;
+    }
+
+    //! \brief Sets the filter used to scale the secondary render target onto the screen.
+    void SetScaleFilter(VIDEO_SCALE_FILTER scale_filter);
+
+    //! \brief Gets the filter used to scale the secondary render target onto the screen.
+    VIDEO_SCALE_FILTER GetScaleFilter() const {
+        return _scale_filter;
+    }
+
     //! \brief Returns a reference to the current coordinate system
     const CoordSys& GetCoordSys() const {
         return _current_context.coordinate_system;
@@ -268,6 +316,13 @@ public:
     **/
     void GetPixelSize(float &x, float &y);
 
+    /** \brief Returns the pixel size expressed in coordinate system units,
+    *** when drawing into the secondary render target.
+    *** \param x A reference of where to store the horizontal resolution
+    *** \param x A reference of where to store the vertical resolution
+    **/
+    void GetSecondaryRenderTargetPixelSize(float &x, float &y) const;
+
     /** \brief applies any changes to video settings like resolution and
      *         fullscreen. If the changes fail, then this function returns
      *         false, and the video settings are reset to whatever the last
@@ -322,16 +377,20 @@ public:
     void EnableTexture2D();
     void DisableTexture2D();
 
-    //! Enables the secondary render target.
+    /** \brief Enables the secondary render target.
+    ***
+    ***        The viewport is set to the whole render target, which is resized first
+    ***        if the internal resolution or the quality level changed.
+    **/
     void EnableSecondaryRenderTarget();
 
-    //! Disables the secondary render target.
+    //! Disables the secondary render target and restores the current context viewport.
     void DisableSecondaryRenderTarget();
 
     /** \brief Draws the secondary render target onto the primary render target.
     ***
     ***        This function automatically disables the secondary render target
-    ***        before drawing its texture to the primary render target.
+    ***        before scaling its texture onto the current viewport using the scale filter.
     **/
     void DrawSecondaryRenderTarget();
 
@@ -740,6 +799,30 @@ private:
     //! It is always on performance when VSync is enabled.
     bool _game_update_mode;
 
+    //! \brief Whether the adaptive quality governor is enabled.
+    bool _adaptive_quality;
+
+    //! \brief The current quality level. 0 is the full quality.
+    uint32_t _quality_level;
+
+    //! \brief The requested internal resolution of the secondary render target.
+    uint32_t _internal_width;
+    uint32_t _internal_height;
+
+    //! \brief The filter used to scale the secondary render target onto the screen.
+    VIDEO_SCALE_FILTER _scale_filter;
+
+    //! \brief The smoothed frame time (in milliseconds) used by the quality governor.
+    float _average_frame_time;
+
+    //! \brief The time (in milliseconds) the frame time has been over or under budget
+    //! since the last quality change. Positive when over budget, negative when under.
+    int32_t _quality_budget_time;
+
+    //! \brief The frame time (in milliseconds) aimed at by the quality governor,
+    //! derived from the display refresh rate when applying the settings.
+    float _frame_time_budget;
+
     //! Image used for rendering rectangles
     StillImage _rectangle_image;
 
@@ -785,10 +868,17 @@ private:
     //! \note it also centers the viewport when the resolution isn't a 4:3 one.
     void _UpdateViewportMetrics();
 
+    //! \brief Computes the secondary render target size from the internal resolution,
+    //! the current viewport size and the quality level.
+    void _GetSecondaryRenderTargetSize(uint32_t &width, uint32_t &height) const;
+
     // Debug info
     //! \brief Updates the FPS counter.
     void _UpdateFPS();
 
+    //! \brief Lowers or raises the quality level according to the recent frame times.
+    void _UpdateQualityGovernor(uint32_t frame_time);
+
     //! \brief Draws the current average FPS to the screen.
     void _DrawFPS();
 };
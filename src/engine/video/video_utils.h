@@ -36,6 +36,25 @@ const float VIDEO_STANDARD_RES_HEIGHT = 768.0f;
 //! \brief The number of FPS samples to retain across frames
 const uint32_t FPS_SAMPLES = 250;
 
+//! \brief The number of adaptive quality levels, 0 being the full quality.
+const uint32_t VIDEO_QUALITY_LEVELS = 4;
+
+//! \brief The secondary render target resolution reduction applied per adaptive quality level.
+const float VIDEO_QUALITY_RESOLUTION_STEP = 0.125f;
+
+//! \brief The filters used to scale the secondary render target onto the screen.
+enum VIDEO_SCALE_FILTER {
+    //! Stretches the render target to the whole viewport with the nearest filter.
+    VIDEO_SCALE_FILTER_NEAREST = 0,
+    //! Scales the render target by the largest integer factor fitting in the viewport,
+    //! centered, with the nearest filter.
+    VIDEO_SCALE_FILTER_INTEGER = 1,
+    //! Stretches the render target to the whole viewport, with the nearest filter
+    //! up to the largest integer factor and a linear filter for the remaining fraction.
+    VIDEO_SCALE_FILTER_SHARP_BILINEAR = 2,
+    VIDEO_SCALE_FILTER_TOTAL = 3
+};
+
 //! \brief Draw flags to control x and y alignment, flipping, and texture blending.
 enum VIDEO_DRAW_FLAGS {
     VIDEO_DRAW_FLAGS_INVALID = -1,
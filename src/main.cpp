@@ -41,6 +41,7 @@
 #include "common/gui/gui.h"
 
 #include "modes/boot/boot.h"
+#include "modes/shop/shop_utils.h"
 #include "main_options.h"
 
 using namespace vt_utils;
@@ -179,6 +180,12 @@ static bool LoadSettings()
         VideoManager->SetVSyncMode(settings.ReadUInt("vsync_mode"));
     if (settings.DoesBoolExist("game_update_mode"))
         VideoManager->SetGameUpdateMode(settings.ReadBool("game_update_mode"));
+    if (settings.DoesBoolExist("adaptive_quality"))
+        VideoManager->SetAdaptiveQuality(settings.ReadBool("adaptive_quality"));
+    if (settings.DoesUIntExist("internal_resx") && settings.DoesUIntExist("internal_resy"))
+        VideoManager->SetInternalResolution(settings.ReadUInt("internal_resx"), settings.ReadUInt("internal_resy"));
+    if (settings.DoesUIntExist("scale_filter"))
+        VideoManager->SetScaleFilter(static_cast<VIDEO_SCALE_FILTER>(settings.ReadUInt("scale_filter")));
     GUIManager->SetUserMenuSkin(settings.ReadString("ui_theme"));
     settings.CloseTable(); // video_settings
 
@@ -561,6 +568,8 @@ int main(int argc, char *argv[])
                 ModeManager->DrawPostEffects();
                 VideoManager->DrawFadeEffect();
                 VideoManager->DrawDebugInfo();
+                if (VideoManager->DebugInfoOn())
+                    AudioManager->DEBUG_DrawTelemetry();
 
                 // Swap the buffers once the draw operations are done.
                 SDL_GL_SwapWindow(sdl_window);
@@ -601,6 +610,9 @@ int main(int argc, char *argv[])
     // Delete the mode manager first so that all game modes free their resources
     ModeEngine::SingletonDestroy();
 
+    // Free the objects kept by shops across visits while their images can still be released
+    vt_shop::private_shop::ShopCatalog::Clear();
+
     // Delete the global manager second to remove all object references corresponding to other engine subsystems
     GameGlobal::SingletonDestroy();
 
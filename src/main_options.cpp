@@ -72,6 +72,18 @@ bool ParseProgramOptions(int32_t &return_code, int32_t argc, char **argv)
                 return false;
             }
             i++;
+        } else if(options[i] == "--log-file") {
+            if((i + 1) >= options.size()) {
+                std::cerr << "Option " << options[i] << " requires an argument." << std::endl;
+                PrintUsage();
+                return_code = 1;
+                return false;
+            }
+            if(vt_utils::SetLogFile(options[i + 1]) == false) {
+                return_code = 1;
+                return false;
+            }
+            i++;
         } else if(options[i] == "--disable-audio") {
             vt_audio::AUDIO_ENABLE = false;
         } else if(options[i] == "-h" || options[i] == "--help") {
@@ -148,6 +160,7 @@ void PrintUsage()
             << "                       utils, video" << std::endl
             << "  --disable-audio   :: disables loading and playing audio" << std::endl
             << "  --help/-h         :: prints this help menu" << std::endl
+            << "  --log-file <file> :: also writes the debug, warning and error messages to <file>" << std::endl
             << "  --info/-i         :: prints information about the user's system" << std::endl
             << "  --reset/-r        :: resets game configuration to use default settings" << std::endl;
 }
@@ -1128,9 +1128,29 @@ void BattleMode::_DrawBottomMenu()
         }
     }
 
+    // Rebuild the status bars and icons batch only when one of the characters status changed.
+    BattleCharacter* character_command = _command_supervisor->GetCommandCharacter();
+    bool status_batch_outdated = _status_batch.IsEmpty() || _status_batch.IsOutdated();
+    for(uint32_t i = 0; i < _character_actors.size(); ++i) {
+        // Every character must be checked so that they all keep track of their batched state.
+        if (_character_actors[i]->IsStatusBatchOutdated(i, character_command))
+            status_batch_outdated = true;
+    }
+
+    if (status_batch_outdated) {
+        // The bars are added first, so that all the icons, sharing the same texture sheet,
+        // end up in a single draw call.
+        _status_batch.Clear();
+        for(uint32_t i = 0; i < _character_actors.size(); ++i)
+            _character_actors[i]->AddStatusBarsToBatch(_status_batch, i);
+        for(uint32_t i = 0; i < _character_actors.size(); ++i)
+            _character_actors[i]->AddStatusIconsToBatch(_status_batch, i, character_command);
+    }
+    _status_batch.Draw();
+
     // Draw the status information of all character actors
     for(uint32_t i = 0; i < _character_actors.size(); i++) {
-        _character_actors[i]->DrawStatus(i, _command_supervisor->GetCommandCharacter());
+        _character_actors[i]->DrawStatus(i);
     }
 }
 
@@ -28,6 +28,7 @@
 #include "battle_menu.h"
 
 #include "engine/mode_manager.h"
+#include "engine/video/image_batch.h"
 
 #include "common/global/global_actors.h"
 
@@ -440,6 +441,9 @@ private:
     **/
     std::vector<private_battle::BattleObject *> _battle_objects;
 
+    //! \brief The characters status bars and icons, drawn at once and rebuilt only when one of them changed.
+    vt_video::ImageBatch _status_batch;
+
     /** \brief The number of character swaps that the player may currently perform
     *** The maximum number of swaps ever allowed is four, thus the value of this class member will always have the range [0, 4].
     *** This member is also used to determine how many swap cards to draw on the battle screen.
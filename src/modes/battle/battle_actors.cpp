@@ -1018,6 +1018,8 @@ BattleCharacter::BattleCharacter(GlobalCharacter *character) :
     _last_rendered_sp(0),
     _sprite_animation_alias("idle")
 {
+    std::fill(_status_batch_state, _status_batch_state + 6, 0);
+
     _last_rendered_hp = GetHitPoints();
     _last_rendered_sp = GetSkillPoints();
 
@@ -1418,83 +1420,104 @@ void BattleCharacter::DrawPortrait()
     }
 }
 
-void BattleCharacter::DrawStatus(uint32_t order, BattleCharacter* character_command)
+//! \brief Returns the vertical offset of a character status in the bottom menu, given its order position.
+static float GetStatusYOffset(uint32_t order)
 {
-    BattleMedia& battle_media = GlobalManager->GetBattleMedia();
-    GlobalMedia& media = GlobalManager->Media();
-    // Used to determine where to draw the character's status
-    float y_offset = 0.0f;
-
-    // Colors used for the HP/SP bars
-    const Color green_hp(0.294f, 0.776f, 0.184f, 1.0f);
-    const Color blue_sp(0.196f, 0.522f, 0.859f, 1.0f);
-
     // Determine what vertical order the character is in and set the y_offset accordingly
     switch(order) {
     case 0:
-        y_offset = 0.0f;
-        break;
+        return 0.0f;
     case 1:
-        y_offset = 25.0f;
-        break;
+        return 25.0f;
     case 2:
-        y_offset = 50.0f;
-        break;
+        return 50.0f;
     case 3:
-        y_offset = 75.0f;
-        break;
+        return 75.0f;
     default:
         IF_PRINT_WARNING(BATTLE_DEBUG) << "invalid order argument: " << order << std::endl;
-        y_offset = 0.0f;
+        return 0.0f;
     }
+}
 
-    // Draw the character's name
-    VideoManager->SetDrawFlags(VIDEO_X_RIGHT, VIDEO_Y_BOTTOM, VIDEO_BLEND, 0);
-    VideoManager->Move(280.0f, 686.0f + y_offset);
-    _name_text.Draw();
+bool BattleCharacter::IsStatusBatchOutdated(uint32_t order, BattleCharacter* character_command)
+{
+    uint32_t command_state = 0;
+    if (character_command)
+        command_state = (this == character_command) ? 1 : 2;
 
-    if (!character_command) {
-        // Draw each characters active status effect.
-        VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_Y_BOTTOM, VIDEO_BLEND, 0);
-        VideoManager->MoveRelative(-273.0f, 0.0f);
-        _effects_supervisor->Draw();
-    } else if (this == character_command) {
-        // Draw the active character status effect at bottom.
-        // Draw each characters active status effect.
-        VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_Y_BOTTOM, VIDEO_BLEND, 0);
-        VideoManager->Move(7.0f, 688.0f);
-        _effects_supervisor->DrawVertical();
+    const uint32_t status_batch_state[6] = { order, command_state,
+                                             GetHitPoints(), GetMaxHitPoints(),
+                                             GetSkillPoints(), GetMaxSkillPoints() };
+
+    // Always check the icons, so that the supervisor keeps track of them.
+    bool outdated = _effects_supervisor->HaveIconsChanged();
+    if (!std::equal(status_batch_state, status_batch_state + 6, _status_batch_state)) {
+        std::copy(status_batch_state, status_batch_state + 6, _status_batch_state);
+        outdated = true;
     }
+    return outdated;
+}
 
-    // Draw the status, HP and SP bars (bars are 88 pixels wide and 6 pixels high).
+void BattleCharacter::AddStatusBarsToBatch(ImageBatch& batch, uint32_t order)
+{
+    float y_offset = GetStatusYOffset(order);
+
+    // Colors used for the HP/SP bars
+    const Color green_hp(0.294f, 0.776f, 0.184f, 1.0f);
+    const Color blue_sp(0.196f, 0.522f, 0.859f, 1.0f);
+
+    // The status, HP and SP bars (bars are 88 pixels wide and 6 pixels high).
     const float BAR_BASE_SIZE_X = 88.0f;
     const float BAR_BASE_SIZE_Y = 6.0f;
-    VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_NO_BLEND, 0);
+    VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_Y_BOTTOM, 0);
 
-    // Draw the HP bar in green.
+    // The HP bar in green.
     float bar_size = static_cast<float>(BAR_BASE_SIZE_X * GetHitPoints()) / static_cast<float>(GetMaxHitPoints());
-    VideoManager->Move(313.0f, 678.0f + y_offset);
-
     if (GetHitPoints() > 0) {
         if (bar_size < BAR_BASE_SIZE_X / 4.0f)
-            VideoManager->DrawRectangle(bar_size, BAR_BASE_SIZE_Y, Color::orange);
+            batch.AddRectangle(313.0f, 678.0f + y_offset, bar_size, BAR_BASE_SIZE_Y, Color::orange);
         else
-            VideoManager->DrawRectangle(bar_size, BAR_BASE_SIZE_Y, green_hp);
+            batch.AddRectangle(313.0f, 678.0f + y_offset, bar_size, BAR_BASE_SIZE_Y, green_hp);
     }
 
-    // Draw the SP bar in blue.
+    // The SP bar in blue.
     bar_size = static_cast<float>(BAR_BASE_SIZE_X * GetSkillPoints()) / static_cast<float>(GetMaxSkillPoints());
-    VideoManager->Move(425.0f, 678.0f + y_offset);
-
     if (GetSkillPoints() > 0)
-        VideoManager->DrawRectangle(bar_size, BAR_BASE_SIZE_Y, blue_sp);
-
-    // Draw the cover image over the top of the bar.
-    VideoManager->SetDrawFlags(VIDEO_BLEND, 0);
-    VideoManager->Move(289.0f, 684.0f + y_offset);
-    media.GetStatusIcon(vt_global::GLOBAL_STATUS_HP, vt_global::GLOBAL_INTENSITY_NEUTRAL)->Draw();
-    VideoManager->MoveRelative(114.0f, 0.0f);
-    media.GetStatusIcon(vt_global::GLOBAL_STATUS_SP, vt_global::GLOBAL_INTENSITY_NEUTRAL)->Draw();
+        batch.AddRectangle(425.0f, 678.0f + y_offset, bar_size, BAR_BASE_SIZE_Y, blue_sp);
+}
+
+void BattleCharacter::AddStatusIconsToBatch(ImageBatch& batch, uint32_t order, BattleCharacter* character_command)
+{
+    GlobalMedia& media = GlobalManager->Media();
+    float y_offset = GetStatusYOffset(order);
+
+    VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_Y_BOTTOM, 0);
+
+    if (!character_command) {
+        // Each characters active status effect, next to its name.
+        _effects_supervisor->AddIconsToBatch(batch, 7.0f, 686.0f + y_offset);
+    } else if (this == character_command) {
+        // The active character status effect at bottom.
+        _effects_supervisor->AddVerticalIconsToBatch(batch, 7.0f, 688.0f);
+    }
+
+    // The cover images over the top of the bars.
+    batch.AddImage(*media.GetStatusIcon(vt_global::GLOBAL_STATUS_HP, vt_global::GLOBAL_INTENSITY_NEUTRAL),
+                   289.0f, 684.0f + y_offset);
+    batch.AddImage(*media.GetStatusIcon(vt_global::GLOBAL_STATUS_SP, vt_global::GLOBAL_INTENSITY_NEUTRAL),
+                   403.0f, 684.0f + y_offset);
+}
+
+void BattleCharacter::DrawStatus(uint32_t order)
+{
+    BattleMedia& battle_media = GlobalManager->GetBattleMedia();
+    // Used to determine where to draw the character's status
+    float y_offset = GetStatusYOffset(order);
+
+    // Draw the character's name
+    VideoManager->SetDrawFlags(VIDEO_X_RIGHT, VIDEO_Y_BOTTOM, VIDEO_BLEND, 0);
+    VideoManager->Move(280.0f, 686.0f + y_offset);
+    _name_text.Draw();
 
     VideoManager->SetDrawFlags(VIDEO_X_CENTER, 0);
     // Draw the character's current health on top of the middle of the HP bar.
@@ -28,6 +28,7 @@
 
 #include "battle_utils.h"
 #include "engine/video/text.h"
+#include "engine/video/image_batch.h"
 #include "engine/video/particle_effect.h"
 
 #include "engine/script/script_read.h"
@@ -659,11 +660,24 @@ public:
     //! \brief Draws the character's damage-blended face portrait
     void DrawPortrait();
 
-    /** \brief Draws the character's status in the bottom area of the screen
+    /** \brief Draws the character's status texts and command buttons in the bottom area of the screen
+    *** \param order The order position of the character [0-3] used to determine draw positions
+    *** \note The status bars and icons are drawn separately through the batch filled by
+    *** AddStatusBarsToBatch() and AddStatusIconsToBatch().
+    **/
+    void DrawStatus(uint32_t order);
+
+    //! \brief Adds the character's HP and SP bars to the status batch
+    void AddStatusBarsToBatch(vt_video::ImageBatch& batch, uint32_t order);
+
+    //! \brief Adds the character's active status effects and bar cover icons to the status batch
+    void AddStatusIconsToBatch(vt_video::ImageBatch& batch, uint32_t order, BattleCharacter* character_command);
+
+    /** \brief Tells whether the character status batched content changed since the last call.
     *** \param order The order position of the character [0-3] used to determine draw positions
     *** \param character_command Tells which character the command menu is open for, if any. (can be nullptr)
     **/
-    void DrawStatus(uint32_t order, BattleCharacter* character_command);
+    bool IsStatusBatchOutdated(uint32_t order, BattleCharacter* character_command);
 
     vt_global::GlobalCharacter *GetGlobalCharacter() {
         return _global_character;
@@ -709,6 +723,9 @@ protected:
 
     //! \brief Rendered icon of the character's currently selected action
     vt_video::StillImage _action_selection_icon;
+
+    //! \brief The order, command state, HP and SP values last added to the status batch.
+    uint32_t _status_batch_state[6];
 }; // class BattleCharacter
 
 
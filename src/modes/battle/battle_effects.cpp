@@ -340,33 +340,60 @@ void BattleStatusEffectsSupervisor::Update()
     _UpdatePassive();
 }
 
-void BattleStatusEffectsSupervisor::Draw()
+void BattleStatusEffectsSupervisor::AddIconsToBatch(ImageBatch& batch, float x, float y) const
 {
-    // Draw in reverse to not overlap the arrow symbol
-    VideoManager->MoveRelative(6.0f * 16.0f, 0.0f);
+    // Add in reverse to not overlap the arrow symbol
+    x += 6.0f * 16.0f;
 
-    for(std::vector<ActiveBattleStatusEffect>::iterator it = _active_status_effects.begin();
+    for(std::vector<ActiveBattleStatusEffect>::const_iterator it = _active_status_effects.begin();
             it != _active_status_effects.end(); ++it) {
-        ActiveBattleStatusEffect& effect = *it;
+        const ActiveBattleStatusEffect& effect = *it;
         if (!effect.IsActive())
             continue;
 
-        effect.GetIconImage()->Draw();
-        VideoManager->MoveRelative(-16.0f, 0.0f);
+        batch.AddImage(*effect.GetIconImage(), x, y);
+        x -= 16.0f;
     }
 }
 
-void BattleStatusEffectsSupervisor::DrawVertical()
+void BattleStatusEffectsSupervisor::AddVerticalIconsToBatch(ImageBatch& batch, float x, float y) const
 {
-    for(std::vector<ActiveBattleStatusEffect>::reverse_iterator it = _active_status_effects.rbegin();
+    for(std::vector<ActiveBattleStatusEffect>::const_reverse_iterator it = _active_status_effects.rbegin();
             it != _active_status_effects.rend(); ++it) {
-        ActiveBattleStatusEffect& effect = *it;
+        const ActiveBattleStatusEffect& effect = *it;
         if (!effect.IsActive())
             continue;
 
-        effect.GetIconImage()->Draw();
-        VideoManager->MoveRelative(0.0f, 16.0f);
+        batch.AddImage(*effect.GetIconImage(), x, y);
+        y += 16.0f;
+    }
+}
+
+bool BattleStatusEffectsSupervisor::HaveIconsChanged()
+{
+    bool icons_changed = false;
+    uint32_t icon_index = 0;
+    for(std::vector<ActiveBattleStatusEffect>::const_iterator it = _active_status_effects.begin();
+            it != _active_status_effects.end(); ++it) {
+        if (!it->IsActive())
+            continue;
+
+        if (icon_index >= _displayed_icons.size()) {
+            _displayed_icons.push_back(it->GetIconImage());
+            icons_changed = true;
+        }
+        else if (_displayed_icons[icon_index] != it->GetIconImage()) {
+            _displayed_icons[icon_index] = it->GetIconImage();
+            icons_changed = true;
+        }
+        ++icon_index;
+    }
+
+    if (icon_index < _displayed_icons.size()) {
+        _displayed_icons.resize(icon_index);
+        icons_changed = true;
     }
+    return icons_changed;
 }
 
 void BattleStatusEffectsSupervisor::RemoveAllActiveStatusEffects()
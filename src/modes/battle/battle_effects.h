@@ -27,6 +27,8 @@
 
 #include "modes/battle/battle_actors.h"
 
+#include "engine/video/image_batch.h"
+
 namespace vt_battle
 {
 
@@ -191,8 +193,8 @@ private:
 *** updated regularly by this class and are removed when their timers expire or their
 *** intensity status is nullified by an external call. This class performs all the
 *** calls to the Lua script functions (Apply/Update/Remove) for each status effect at
-*** the appropriate time. The class also contains a draw function which will display
-*** icons for all the active status effects of an actor to the screen.
+*** the appropriate time. The class also provides the icons of all the active status
+*** effects of an actor to the battle status display.
 *** ***************************************************************************/
 class BattleStatusEffectsSupervisor
 {
@@ -206,10 +208,16 @@ public:
     //! \brief Updates the timers and state of any effects
     void Update();
 
-    //! \brief Draws the element and status effect icons to the bottom status menu
-    void Draw();
-    //! \brief Draws the same active effects but vertically
-    void DrawVertical();
+    /** \brief Adds the active status effect icons of the bottom status menu to the given batch.
+    *** \param x, y The position of the leftmost icon.
+    **/
+    void AddIconsToBatch(vt_video::ImageBatch& batch, float x, float y) const;
+
+    //! \brief Adds the same active effects icons but vertically, from the given position downward.
+    void AddVerticalIconsToBatch(vt_video::ImageBatch& batch, float x, float y) const;
+
+    //! \brief Tells whether the active effects icons changed since the last call.
+    bool HaveIconsChanged();
 
     /** \brief Returns true if the requested status is active on the managed actor
     *** \param status The type of status effect to check for
@@ -278,6 +286,9 @@ private:
     //! Those status effects can never be cancelled. They are simply updated.
     std::vector<PassiveBattleStatusEffect> _equipment_status_effects;
 
+    //! \brief The active effects icons as of the last HaveIconsChanged() call.
+    std::vector<vt_video::StillImage*> _displayed_icons;
+
     /** \brief Creates a new status effect and applies it to the actor
     *** \param status The type of the status to create
     *** \param intensity The intensity level that the effect should be initialized at
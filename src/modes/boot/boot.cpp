@@ -375,24 +375,21 @@ void BootMode::DrawPostEffects()
 // ****************************************************************************
 bool BootMode::_SavesAvailable()
 {
-    int32_t savesAvailable = 0;
-    std::string data_path = GetUserDataPath();
+    RefreshSaveFileCatalog();
+
     uint32_t max_slot_id = SystemManager->GetGameSaveSlots();
     for(uint32_t id = 0; id < max_slot_id; ++id) {
-        std::ostringstream f;
-        f << data_path + "saved_game_" << id << ".lua";
-        const std::string filename = f.str();
-
-        if(DoesFileExist(filename)) {
-            ++savesAvailable;
-        }
+        if(GetSaveFileInfo(id).exists)
+            return true;
     }
-    return (savesAvailable > 0);
+    return false;
 }
 
 void BootMode::ReloadTranslatedTexts()
 {
-    _SetupMainMenu();
+    // The main menu options are translated again on their next draw.
+    _f1_help_text.SetText(VTranslate("Press '%s' to get to know about the game keys.",
+                                     InputManager->GetHelpKeyName()));
 }
 
 void BootMode::_SetupMainMenu()
@@ -407,9 +404,9 @@ void BootMode::_SetupMainMenu()
     _main_menu.SetCursorOffset(-50.0f, -28.0f);
     _main_menu.SetSkipDisabled(true);
 
-    _main_menu.AddOption(UTranslate("New Game"));
-    _main_menu.AddOption(UTranslate("Load Game"));
-    _main_menu.AddOption(UTranslate("Options"));
+    _main_menu.AddTranslatableOption("New Game");
+    _main_menu.AddTranslatableOption("Load Game");
+    _main_menu.AddTranslatableOption("Options");
     // Insert the debug options
 #ifdef DEBUG_FEATURES
     _main_menu.SetDimensions(1000.0f, 50.0f, 5, 1, 5, 1);
@@ -419,7 +416,7 @@ void BootMode::_SetupMainMenu()
 #else
     _main_menu.SetDimensions(800.0f, 50.0f, 4, 1, 4, 1);
 #endif
-    _main_menu.AddOption(UTranslate("Quit"));
+    _main_menu.AddTranslatableOption("Quit");
 
 
     if(!_SavesAvailable()) {
@@ -22,6 +22,7 @@
 #include "modes/map/map_events.h"
 #include "modes/map/map_sprites.h"
 
+#include "engine/audio/audio.h"
 #include "engine/input.h"
 
 #include "common/global/global.h"
@@ -47,6 +48,9 @@ namespace vt_map
 namespace private_map
 {
 
+//! \brief The gain the map ambient sounds are lowered to while a dialogue is active
+const float DIALOGUE_AMBIENCE_GAIN = 0.5f;
+
 ///////////////////////////////////////////////////////////////////////////////
 // SpriteDialogue Class Functions
 ///////////////////////////////////////////////////////////////////////////////
@@ -243,7 +247,7 @@ bool SpriteDialogue::Validate()
         if((*it).empty())
             continue;
 
-        if(MapMode::CurrentInstance()->GetEventSupervisor()->GetEvent(*it) == nullptr) {
+        if(!MapMode::CurrentInstance()->GetEventSupervisor()->DoesEventExist(*it)) {
             IF_PRINT_WARNING(MAP_DEBUG) << "Validation failed for dialogue #" << _dialogue_id
                                         << ": dialogue referenced invalid event with id: " << *it << std::endl;
             return false;
@@ -297,6 +301,10 @@ MapDialogueSupervisor::MapDialogueSupervisor() :
 
 MapDialogueSupervisor::~MapDialogueSupervisor()
 {
+    // Don't leave the ambience ducked when the map is left during a dialogue.
+    if(_current_dialogue != nullptr)
+        AudioManager->UnduckBus(AUDIO_BUS_AMBIENCE);
+
     _current_dialogue = nullptr;
     _current_options = nullptr;
 
@@ -374,6 +382,9 @@ void MapDialogueSupervisor::StartDialogue(const std::string& dialogue_id)
     _emote_triggered = false;
     _BeginLine();
     MapMode::CurrentInstance()->PushState(STATE_DIALOGUE);
+
+    // Let the ambient sounds fade behind the dialogue
+    AudioManager->DuckBus(AUDIO_BUS_AMBIENCE, DIALOGUE_AMBIENCE_GAIN);
 }
 
 void MapDialogueSupervisor::EndDialogue()
@@ -411,6 +422,7 @@ void MapDialogueSupervisor::EndDialogue()
     }
 
     map_mode->PopState();
+    AudioManager->UnduckBus(AUDIO_BUS_AMBIENCE);
 
     std::string event_id = _current_dialogue->GetEventAtDialogueEnd();
     if (!event_id.empty()) {
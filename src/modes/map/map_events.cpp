@@ -40,6 +40,34 @@ namespace vt_map
 namespace private_map
 {
 
+/** \brief Reads up to two functions from the current map script 'map_functions' table.
+*** \note Empty function names are ignored. This is done when the events are started
+*** rather than at creation, so that unused events don't cost any script lookup.
+**/
+static void _ReadMapFunctions(const std::string& first_function, luabind::object& first_object,
+                              const std::string& second_function, luabind::object& second_object)
+{
+    if(first_function.empty() && second_function.empty())
+        return;
+
+    ReadScriptDescriptor &map_script = MapMode::CurrentInstance()->GetMapScript();
+    if (!MapMode::CurrentInstance()->OpenMapTablespace(true))
+        return;
+    if (!map_script.OpenTable("map_functions")) {
+        map_script.CloseTable(); // tablespace
+        return;
+    }
+
+    if(!first_function.empty())
+        first_object = map_script.ReadFunctionPointer(first_function);
+
+    if(!second_function.empty())
+        second_object = map_script.ReadFunctionPointer(second_function);
+
+    map_script.CloseTable(); // map_functions
+    map_script.CloseTable(); // tablespace
+}
+
 MapEvent::MapEvent(const std::string& id, EVENT_TYPE type):
     _event_id(id),
     _event_type(type)
@@ -271,22 +299,11 @@ void BattleEncounterEvent::_Start()
 
 IfEvent::IfEvent(const std::string& event_id, const std::string& check_function,
                  const std::string& on_true_event, const std::string& on_false_event) :
-    MapEvent(event_id, IF_EVENT)
+    MapEvent(event_id, IF_EVENT),
+    _check_function_name(check_function),
+    _true_event_id(on_true_event),
+    _false_event_id(on_false_event)
 {
-    ReadScriptDescriptor &map_script = MapMode::CurrentInstance()->GetMapScript();
-    if (!MapMode::CurrentInstance()->OpenMapTablespace(true))
-        return;
-    if (!map_script.OpenTable("map_functions"))
-        return;
-
-    if(!check_function.empty())
-        _check_function = map_script.ReadFunctionPointer(check_function);
-
-    map_script.CloseTable(); // map_functions
-    map_script.CloseTable(); // tablespace
-
-    _true_event_id = on_true_event;
-    _false_event_id = on_false_event;
 }
 
 IfEvent* IfEvent::Create(const std::string& event_id, const std::string& check_function,
@@ -297,6 +314,13 @@ IfEvent* IfEvent::Create(const std::string& event_id, const std::string& check_f
 
 void IfEvent::_Start()
 {
+    // Bind the check function on first use only.
+    if(!_check_function_name.empty()) {
+        luabind::object no_function;
+        _ReadMapFunctions(_check_function_name, _check_function, std::string(), no_function);
+        _check_function_name.clear();
+    }
+
     if(!_check_function.is_valid())
         return;
 
@@ -328,22 +352,11 @@ void IfEvent::_Start()
 ScriptedEvent::ScriptedEvent(const std::string& event_id,
                              const std::string& start_function,
                              const std::string& update_function) :
-    MapEvent(event_id, SCRIPTED_EVENT)
+    MapEvent(event_id, SCRIPTED_EVENT),
+    _start_function_name(start_function),
+    _update_function_name(update_function),
+    _functions_bound(false)
 {
-    ReadScriptDescriptor &map_script = MapMode::CurrentInstance()->GetMapScript();
-    if (!MapMode::CurrentInstance()->OpenMapTablespace(true))
-        return;
-    if (!map_script.OpenTable("map_functions"))
-        return;
-
-    if(!start_function.empty())
-        _start_function = map_script.ReadFunctionPointer(start_function);
-
-    if(!update_function.empty())
-        _update_function = map_script.ReadFunctionPointer(update_function);
-
-    map_script.CloseTable(); // map_functions
-    map_script.CloseTable(); // tablespace
 }
 
 ScriptedEvent* ScriptedEvent::Create(const std::string& event_id,
@@ -355,6 +368,12 @@ ScriptedEvent* ScriptedEvent::Create(const std::string& event_id,
 
 void ScriptedEvent::_Start()
 {
+    if(!_functions_bound) {
+        _ReadMapFunctions(_start_function_name, _start_function,
+                          _update_function_name, _update_function);
+        _functions_bound = true;
+    }
+
     if(!_start_function.is_valid())
         return;
 
@@ -392,6 +411,7 @@ bool ScriptedEvent::_Update()
 
 SpriteEvent::SpriteEvent(const std::string& event_id, EVENT_TYPE event_type, VirtualSprite* sprite) :
     MapEvent(event_id, event_type),
+    _sprite_handle(sprite ? sprite->GetHandle() : MapObjectHandle()),
     _sprite(sprite)
 {
     if(sprite == nullptr)
@@ -399,12 +419,25 @@ SpriteEvent::SpriteEvent(const std::string& event_id, EVENT_TYPE event_type, Vir
                                     << event_id << std::endl;
 }
 
-void SpriteEvent::_Start()
+VirtualSprite* SpriteEvent::GetSprite() const
+{
+    return MapMode::CurrentInstance()->GetObjectSupervisor()->GetSprite(_sprite_handle);
+}
+
+bool SpriteEvent::_ResolveSprite()
 {
+    _sprite = GetSprite();
     if (!_sprite) {
-        PRINT_WARNING << "No valid sprite given in event: " << GetEventID() << std::endl;
-        return;
+        PRINT_WARNING << "No valid sprite given in event, or the sprite was deleted: " << GetEventID() << std::endl;
+        return false;
     }
+    return true;
+}
+
+void SpriteEvent::_Start()
+{
+    if (!_ResolveSprite())
+        return;
 
     EventSupervisor *event_supervisor = MapMode::CurrentInstance()->GetEventSupervisor();
     // Terminate the previous event whenever it is another sprite event.
@@ -418,8 +451,9 @@ void SpriteEvent::_Start()
 void SpriteEvent::Terminate()
 {
     // Frees the sprite from the event.
-    if(_sprite && _sprite->GetControlEvent() == this) {
-        _sprite->ReleaseControl(this);
+    VirtualSprite* sprite = GetSprite();
+    if(sprite && sprite->GetControlEvent() == this) {
+        sprite->ReleaseControl(this);
     }
 }
 
@@ -430,22 +464,11 @@ void SpriteEvent::Terminate()
 ScriptedSpriteEvent::ScriptedSpriteEvent(const std::string& event_id, VirtualSprite* sprite,
                                          const std::string& start_function,
                                          const std::string& update_function) :
-    SpriteEvent(event_id, SCRIPTED_SPRITE_EVENT, sprite)
+    SpriteEvent(event_id, SCRIPTED_SPRITE_EVENT, sprite),
+    _start_function_name(start_function),
+    _update_function_name(update_function),
+    _functions_bound(false)
 {
-    ReadScriptDescriptor &map_script = MapMode::CurrentInstance()->GetMapScript();
-    if (!MapMode::CurrentInstance()->OpenMapTablespace(true))
-        return;
-    if (!map_script.OpenTable("map_functions"))
-        return;
-
-    if(!start_function.empty())
-        _start_function = map_script.ReadFunctionPointer(start_function);
-
-    if(!update_function.empty())
-        _update_function = map_script.ReadFunctionPointer(update_function);
-
-    map_script.CloseTable(); // map_functions
-    map_script.CloseTable(); // tablespace
 }
 
 ScriptedSpriteEvent* ScriptedSpriteEvent::Create(const std::string& event_id,
@@ -458,13 +481,22 @@ ScriptedSpriteEvent* ScriptedSpriteEvent::Create(const std::string& event_id,
 
 void ScriptedSpriteEvent::_Start()
 {
+    if(!_functions_bound) {
+        _ReadMapFunctions(_start_function_name, _start_function,
+                          _update_function_name, _update_function);
+        _functions_bound = true;
+    }
+
     SpriteEvent::_Start();
-    if(_start_function.is_valid())
+    if(_sprite && _start_function.is_valid())
         luabind::call_function<void>(_start_function, _sprite);
 }
 
 bool ScriptedSpriteEvent::_Update()
 {
+    if(!_ResolveSprite())
+        return true;
+
     bool finished = false;
     if(_update_function.is_valid()) {
         finished = luabind::call_function<bool>(_update_function, _sprite);
@@ -502,7 +534,8 @@ ChangeDirectionSpriteEvent* ChangeDirectionSpriteEvent::Create(const std::string
 void ChangeDirectionSpriteEvent::_Start()
 {
     SpriteEvent::_Start();
-    _sprite->SetDirection(_direction);
+    if(_sprite)
+        _sprite->SetDirection(_direction);
 }
 
 bool ChangeDirectionSpriteEvent::_Update()
@@ -518,17 +551,17 @@ LookAtSpriteEvent::LookAtSpriteEvent(const std::string& event_id, VirtualSprite*
 {
     // Invalid position.
     _x = _y = -1.0f;
-    _target_sprite = other_sprite;
 
-    if(!_target_sprite)
+    if(other_sprite)
+        _target_sprite = other_sprite->GetHandle();
+    else
         IF_PRINT_WARNING(MAP_DEBUG) << "Invalid other sprite specified in event: " << event_id << std::endl;
 }
 
 LookAtSpriteEvent::LookAtSpriteEvent(const std::string& event_id, VirtualSprite* sprite, float x, float y) :
     SpriteEvent(event_id, LOOK_AT_SPRITE_EVENT, sprite),
     _x(x),
-    _y(y),
-    _target_sprite(0)
+    _y(y)
 {}
 
 LookAtSpriteEvent* LookAtSpriteEvent::Create(const std::string& event_id,
@@ -548,11 +581,18 @@ LookAtSpriteEvent* LookAtSpriteEvent::Create(const std::string& event_id,
 void LookAtSpriteEvent::_Start()
 {
     SpriteEvent::_Start();
+    if(!_sprite)
+        return;
 
     // When there is a target sprite, use it.
-    if(_target_sprite) {
-        _x = _target_sprite->GetXPosition();
-        _y = _target_sprite->GetYPosition();
+    if(!_target_sprite.IsNull()) {
+        VirtualSprite* target_sprite = MapMode::CurrentInstance()->GetObjectSupervisor()->GetSprite(_target_sprite);
+        if(target_sprite) {
+            _x = target_sprite->GetXPosition();
+            _y = target_sprite->GetYPosition();
+        } else {
+            PRINT_WARNING << "The sprite to look at doesn't exist anymore in event: " << GetEventID() << std::endl;
+        }
     }
 
     if(_x >= 0.0f && _y >= 0.0f)
@@ -574,7 +614,6 @@ PathMoveSpriteEvent::PathMoveSpriteEvent(const std::string& event_id, VirtualSpr
     SpriteEvent(event_id, PATH_MOVE_SPRITE_EVENT, sprite),
     _destination_x(x_coord),
     _destination_y(y_coord),
-    _target_sprite(nullptr),
     _last_x_position(0.0f),
     _last_y_position(0.0f),
     _current_node_x(0.0f),
@@ -588,7 +627,7 @@ PathMoveSpriteEvent::PathMoveSpriteEvent(const std::string& event_id, VirtualSpr
     SpriteEvent(event_id, PATH_MOVE_SPRITE_EVENT, sprite),
     _destination_x(-1.0f),
     _destination_y(-1.0f),
-    _target_sprite(target_sprite),
+    _target_sprite(target_sprite ? target_sprite->GetHandle() : MapObjectHandle()),
     _last_x_position(0.0f),
     _last_y_position(0.0f),
     _current_node_x(0.0f),
@@ -621,7 +660,7 @@ void PathMoveSpriteEvent::SetDestination(float x_coord, float y_coord, bool run)
 
     _destination_x = x_coord;
     _destination_y = y_coord;
-    _target_sprite = nullptr;
+    _target_sprite = MapObjectHandle();
     _path.clear();
     _run = run;
 }
@@ -636,7 +675,7 @@ void PathMoveSpriteEvent::SetDestination(VirtualSprite* target_sprite, bool run)
 
     _destination_x = -1.0f;
     _destination_y = -1.0f;
-    _target_sprite = target_sprite;
+    _target_sprite = target_sprite ? target_sprite->GetHandle() : MapObjectHandle();
     _path.clear();
     _run = run;
 }
@@ -644,6 +683,10 @@ void PathMoveSpriteEvent::SetDestination(VirtualSprite* target_sprite, bool run)
 void PathMoveSpriteEvent::_Start()
 {
     SpriteEvent::_Start();
+    if(!_sprite) {
+        _path.clear();
+        return;
+    }
 
     _current_node = 0;
     _last_x_position = _sprite->GetXPosition();
@@ -652,9 +695,15 @@ void PathMoveSpriteEvent::_Start()
 
     // Only set the destination at start call since the target coord may have changed
     // between the load time and the event actual start.
-    if(_target_sprite) {
-        _destination_x = _target_sprite->GetXPosition();
-        _destination_y = _target_sprite->GetYPosition();
+    if(!_target_sprite.IsNull()) {
+        VirtualSprite* target_sprite = MapMode::CurrentInstance()->GetObjectSupervisor()->GetSprite(_target_sprite);
+        if(!target_sprite) {
+            PRINT_WARNING << "The destination sprite doesn't exist anymore in event: " << GetEventID() << std::endl;
+            _path.clear();
+            return;
+        }
+        _destination_x = target_sprite->GetXPosition();
+        _destination_y = target_sprite->GetYPosition();
     }
 
     MapPosition dest(_destination_x, _destination_y);
@@ -680,6 +729,9 @@ void PathMoveSpriteEvent::_Start()
 
 bool PathMoveSpriteEvent::_Update()
 {
+    if(!_ResolveSprite())
+        return true;
+
     if(_path.empty()) {
         // No path
         Terminate();
@@ -720,7 +772,9 @@ bool PathMoveSpriteEvent::_Update()
 
 void PathMoveSpriteEvent::Terminate()
 {
-    _sprite->SetMoving(false);
+    VirtualSprite* sprite = GetSprite();
+    if(sprite)
+        sprite->SetMoving(false);
     SpriteEvent::Terminate();
 }
 
@@ -791,12 +845,17 @@ RandomMoveSpriteEvent* RandomMoveSpriteEvent::Create(const std::string& event_id
 void RandomMoveSpriteEvent::_Start()
 {
     SpriteEvent::_Start();
+    if(!_sprite)
+        return;
     _sprite->SetRandomDirection();
     _sprite->SetMoving(true);
 }
 
 bool RandomMoveSpriteEvent::_Update()
 {
+    if(!_ResolveSprite())
+        return true;
+
     _direction_timer += SystemManager->GetUpdateTime();
     _movement_timer += SystemManager->GetUpdateTime();
 
@@ -817,7 +876,9 @@ bool RandomMoveSpriteEvent::_Update()
 
 void RandomMoveSpriteEvent::Terminate()
 {
-    _sprite->SetMoving(false);
+    VirtualSprite* sprite = GetSprite();
+    if(sprite)
+        sprite->SetMoving(false);
     SpriteEvent::Terminate();
 }
 
@@ -831,7 +892,6 @@ AnimateSpriteEvent::AnimateSpriteEvent(const std::string& event_id, VirtualSprit
     _animation_name(animation_name),
     _animation_time(animation_time)
 {
-    _map_sprite = dynamic_cast<MapSprite *>(_sprite);
 }
 
 AnimateSpriteEvent* AnimateSpriteEvent::Create(const std::string& event_id,
@@ -846,13 +906,18 @@ void AnimateSpriteEvent::_Start()
 {
     SpriteEvent::_Start();
 
-    if(_map_sprite)
-        _map_sprite->SetCustomAnimation(_animation_name, _animation_time);
+    MapSprite* map_sprite = dynamic_cast<MapSprite *>(_sprite);
+    if(map_sprite)
+        map_sprite->SetCustomAnimation(_animation_name, _animation_time);
 }
 
 bool AnimateSpriteEvent::_Update()
 {
-    if(!_map_sprite || !_map_sprite->IsAnimationCustom()) {
+    if(!_ResolveSprite())
+        return true;
+
+    MapSprite* map_sprite = dynamic_cast<MapSprite *>(_sprite);
+    if(!map_sprite || !map_sprite->IsAnimationCustom()) {
         Terminate();
         return true;
     }
@@ -863,9 +928,9 @@ void AnimateSpriteEvent::Terminate()
 {
     // Disable a possible still running custom animation.
     // Useful when calling EndAllEvents() on a sprite.
-    if (_map_sprite)
-        _map_sprite->DisableCustomAnimation();
-    _map_sprite = 0;
+    MapSprite* map_sprite = dynamic_cast<MapSprite *>(GetSprite());
+    if (map_sprite)
+        map_sprite->DisableCustomAnimation();
     _animation_name.clear();
     _animation_time = 0;
     SpriteEvent::Terminate();
@@ -1376,14 +1441,70 @@ bool EventSupervisor::IsEventActive(const std::string &event_id) const
     return false;
 }
 
-MapEvent *EventSupervisor::GetEvent(const std::string &event_id) const
+MapEvent *EventSupervisor::GetEvent(const std::string &event_id)
 {
     std::map<std::string, MapEvent *>::const_iterator it = _all_events.find(event_id);
 
-    if(it == _all_events.end())
-        return nullptr;
-    else
+    if(it != _all_events.end())
         return it->second;
+
+    return _CreateDeclaredEvent(event_id);
+}
+
+bool EventSupervisor::DoesEventExist(const std::string &event_id) const
+{
+    return _all_events.find(event_id) != _all_events.end()
+        || _declared_events.find(event_id) != _declared_events.end();
+}
+
+void EventSupervisor::DeclareEvent(const std::string &event_id, const std::string &create_function)
+{
+    if(DoesEventExist(event_id)) {
+        PRINT_WARNING << "The event with this ID already existed: '" << event_id
+                      << "' in map script: "
+                      << MapMode::CurrentInstance()->GetMapScriptFilename() << std::endl;
+        return;
+    }
+
+    _declared_events.insert(std::make_pair(event_id, create_function));
+}
+
+MapEvent *EventSupervisor::_CreateDeclaredEvent(const std::string &event_id)
+{
+    std::map<std::string, std::string>::iterator it = _declared_events.find(event_id);
+    if(it == _declared_events.end())
+        return nullptr;
+
+    // Remove the declaration first so that a failing creation isn't attempted again.
+    std::string create_function = it->second;
+    _declared_events.erase(it);
+
+    luabind::object function_object;
+    _ReadMapFunctions(create_function, function_object, std::string(), function_object);
+    if(!function_object.is_valid()) {
+        PRINT_WARNING << "Invalid creation function: '" << create_function
+                      << "' for declared event: '" << event_id << "' in map script: "
+                      << MapMode::CurrentInstance()->GetMapScriptFilename() << std::endl;
+        return nullptr;
+    }
+
+    try {
+        luabind::call_function<void>(function_object, event_id);
+    } catch(const luabind::error &e) {
+        PRINT_ERROR << "Error while creating declared event: " << event_id << std::endl;
+        ScriptManager->HandleLuaError(e);
+    } catch(const luabind::cast_failed &e) {
+        PRINT_ERROR << "Error while creating declared event: " << event_id << std::endl;
+        ScriptManager->HandleCastError(e);
+    }
+
+    std::map<std::string, MapEvent *>::const_iterator event_it = _all_events.find(event_id);
+    if(event_it == _all_events.end()) {
+        PRINT_WARNING << "The creation function: '" << create_function
+                      << "' didn't create the declared event: '" << event_id << "'" << std::endl;
+        return nullptr;
+    }
+    return event_it->second;
 }
 
 bool EventSupervisor::_RegisterEvent(MapEvent* new_event)
@@ -1393,7 +1514,7 @@ bool EventSupervisor::_RegisterEvent(MapEvent* new_event)
         return false;
     }
 
-    if(GetEvent(new_event->_event_id) != nullptr) {
+    if(_all_events.find(new_event->_event_id) != _all_events.end()) {
         PRINT_WARNING << "The event with this ID already existed: '"
                       << new_event->_event_id
                       << "' in map script: "
@@ -1401,10 +1522,289 @@ bool EventSupervisor::_RegisterEvent(MapEvent* new_event)
         return false;
     }
 
+    // The event might have been declared and created by another event creation function.
+    _declared_events.erase(new_event->_event_id);
+
     _all_events.insert(std::make_pair(new_event->_event_id, new_event));
     return true;
 }
 
+//! \brief Returns the string value of a graph table field, or an empty string.
+static std::string _ReadGraphString(const luabind::object& table, const std::string& key)
+{
+    luabind::object value = table[key];
+    if(luabind::type(value) != LUA_TSTRING)
+        return std::string();
+    return luabind::object_cast<std::string>(value);
+}
+
+//! \brief Returns the number value of a graph table field, or the default value.
+static float _ReadGraphNumber(const luabind::object& table, const std::string& key, float default_value)
+{
+    luabind::object value = table[key];
+    if(luabind::type(value) != LUA_TNUMBER)
+        return default_value;
+    return luabind::object_cast<float>(value);
+}
+
+//! \brief Returns the boolean value of a graph table field, or the default value.
+static bool _ReadGraphBool(const luabind::object& table, const std::string& key, bool default_value)
+{
+    luabind::object value = table[key];
+    if(luabind::type(value) != LUA_TBOOLEAN)
+        return default_value;
+    return luabind::object_cast<bool>(value);
+}
+
+//! \brief Returns the C++ object pointer of a graph table field, or nullptr.
+template <class T> static T* _ReadGraphObject(const luabind::object& table, const std::string& key)
+{
+    luabind::object value = table[key];
+    if(luabind::type(value) != LUA_TUSERDATA)
+        return nullptr;
+
+    try {
+        return luabind::object_cast<T*>(value);
+    } catch(const luabind::cast_failed&) {
+        return nullptr;
+    }
+}
+
+//! \brief Tells whether the graph nodes reachable from the given node index contain a cycle.
+static bool _HasGraphCycle(const std::vector<EventGraphNode>& nodes, uint32_t first_node,
+                           uint32_t index, std::vector<uint8_t>& states)
+{
+    // 0: not visited, 1: being visited, 2: done
+    states[index - first_node] = 1;
+    const std::vector<EventGraphLink>& links = nodes[index].links;
+    for(uint32_t i = 0; i < links.size(); ++i) {
+        if(links[i].child_index < 0)
+            continue;
+
+        uint32_t child = static_cast<uint32_t>(links[i].child_index);
+        if(states[child - first_node] == 1)
+            return true;
+        if(states[child - first_node] == 0 && _HasGraphCycle(nodes, first_node, child, states))
+            return true;
+    }
+    states[index - first_node] = 2;
+    return false;
+}
+
+//! \brief Tells whether the graph node table has a number field with the given key.
+static bool _HasGraphNumber(const luabind::object& table, const std::string& key)
+{
+    return luabind::type(table[key]) == LUA_TNUMBER;
+}
+
+//! \brief Checks the type and the parameters of a graph node table, before any event gets created.
+static bool _IsGraphNodeValid(const luabind::object& node, const std::string& type)
+{
+    if(type == "scripted")
+        return true;
+    if(type == "sound")
+        return !_ReadGraphString(node, "filename").empty();
+    if(type == "map_transition")
+        return !_ReadGraphString(node, "data_file").empty() && !_ReadGraphString(node, "script_file").empty();
+    if(type == "if")
+        return !_ReadGraphString(node, "check").empty();
+    if(type == "dialogue")
+        return _ReadGraphObject<SpriteDialogue>(node, "dialogue") != nullptr;
+
+    // The other node types are all sprite events.
+    if(type != "scripted_sprite" && type != "change_direction" && type != "look_at"
+            && type != "path_move" && type != "random_move" && type != "animate")
+        return false;
+    if(_ReadGraphObject<VirtualSprite>(node, "sprite") == nullptr)
+        return false;
+
+    // Those need somewhere to go or to look at.
+    if(type == "look_at" || type == "path_move") {
+        return _ReadGraphObject<VirtualSprite>(node, "target") != nullptr
+               || (_HasGraphNumber(node, "x") && _HasGraphNumber(node, "y"));
+    }
+    if(type == "change_direction")
+        return _HasGraphNumber(node, "direction");
+    if(type == "animate")
+        return !_ReadGraphString(node, "animation").empty();
+    return true;
+}
+
+//! \brief Creates the event described by a graph node table, or returns nullptr if the node is invalid.
+static MapEvent* _CreateGraphEvent(const luabind::object& node, const std::string& event_id,
+                                   const std::string& type)
+{
+    if(type == "scripted")
+        return ScriptedEvent::Create(event_id, _ReadGraphString(node, "start"), _ReadGraphString(node, "update"));
+    if(type == "sound")
+        return SoundEvent::Create(event_id, _ReadGraphString(node, "filename"));
+    if(type == "map_transition")
+        return MapTransitionEvent::Create(event_id, _ReadGraphString(node, "data_file"),
+                                          _ReadGraphString(node, "script_file"),
+                                          _ReadGraphString(node, "coming_from"));
+    if(type == "if")
+        return IfEvent::Create(event_id, _ReadGraphString(node, "check"),
+                               _ReadGraphString(node, "on_true"), _ReadGraphString(node, "on_false"));
+
+    if(type == "dialogue") {
+        SpriteDialogue* dialogue = _ReadGraphObject<SpriteDialogue>(node, "dialogue");
+        if(dialogue == nullptr)
+            return nullptr;
+        DialogueEvent* event = DialogueEvent::Create(event_id, dialogue);
+        event->SetStopCameraMovement(_ReadGraphBool(node, "stop_camera", false));
+        return event;
+    }
+
+    // The other node types are all sprite events.
+    VirtualSprite* sprite = _ReadGraphObject<VirtualSprite>(node, "sprite");
+    if(sprite == nullptr)
+        return nullptr;
+
+    VirtualSprite* target = _ReadGraphObject<VirtualSprite>(node, "target");
+    float x = _ReadGraphNumber(node, "x", 0.0f);
+    float y = _ReadGraphNumber(node, "y", 0.0f);
+
+    if(type == "scripted_sprite")
+        return ScriptedSpriteEvent::Create(event_id, sprite, _ReadGraphString(node, "start"),
+                                           _ReadGraphString(node, "update"));
+    if(type == "change_direction")
+        return ChangeDirectionSpriteEvent::Create(event_id, sprite,
+                                                  static_cast<uint16_t>(_ReadGraphNumber(node, "direction", 0.0f)));
+    if(type == "look_at")
+        return target ? LookAtSpriteEvent::Create(event_id, sprite, target)
+                      : LookAtSpriteEvent::Create(event_id, sprite, x, y);
+    if(type == "path_move") {
+        bool run = _ReadGraphBool(node, "run", false);
+        return target ? PathMoveSpriteEvent::Create(event_id, sprite, target, run)
+                      : PathMoveSpriteEvent::Create(event_id, sprite, x, y, run);
+    }
+    if(type == "random_move")
+        return RandomMoveSpriteEvent::Create(event_id, sprite,
+                                             static_cast<uint32_t>(_ReadGraphNumber(node, "move_time", 10000.0f)),
+                                             static_cast<uint32_t>(_ReadGraphNumber(node, "direction_time", 2000.0f)));
+    if(type == "animate")
+        return AnimateSpriteEvent::Create(event_id, sprite, _ReadGraphString(node, "animation"),
+                                          static_cast<int32_t>(_ReadGraphNumber(node, "time", -1.0f)));
+    return nullptr;
+}
+
+bool EventSupervisor::LoadEventGraph(const luabind::object& graph)
+{
+    const std::string& map_filename = MapMode::CurrentInstance()->GetMapScriptFilename();
+
+    if(luabind::type(graph) != LUA_TTABLE || luabind::type(graph["nodes"]) != LUA_TTABLE) {
+        PRINT_WARNING << "Invalid event graph, no 'nodes' table in map script: " << map_filename << std::endl;
+        return false;
+    }
+
+    // Read and check the nodes first, so that nothing is created if the graph is invalid.
+    const uint32_t first_node = _event_graph_nodes.size();
+    std::vector<EventGraphNode> nodes;
+    std::vector<luabind::object> node_tables;
+    std::vector<std::string> node_types;
+    std::map<std::string, uint32_t> node_indices;
+
+    luabind::object nodes_table = graph["nodes"];
+    for(uint32_t i = 1; luabind::type(nodes_table[i]) == LUA_TTABLE; ++i) {
+        luabind::object node_table = nodes_table[i];
+        EventGraphNode node;
+        node.event_id = _ReadGraphString(node_table, "id");
+        node.event_type = INVALID_EVENT;
+
+        if(node.event_id.empty() || DoesEventExist(node.event_id)
+                || node_indices.find(node.event_id) != node_indices.end()) {
+            PRINT_WARNING << "Invalid or already existing event id: '" << node.event_id
+                          << "' in event graph node #" << i << " of map script: " << map_filename << std::endl;
+            return false;
+        }
+
+        std::string type = _ReadGraphString(node_table, "type");
+        if(!_IsGraphNodeValid(node_table, type)) {
+            PRINT_WARNING << "Invalid type or parameters in event graph node: '" << node.event_id << "' of type: '"
+                          << type << "' in map script: " << map_filename << std::endl;
+            return false;
+        }
+
+        node_indices.insert(std::make_pair(node.event_id, first_node + nodes.size()));
+        nodes.push_back(node);
+        node_tables.push_back(node_table);
+        node_types.push_back(type);
+    }
+
+    // Resolve the links into node indices
+    luabind::object links_table = graph["links"];
+    if(luabind::type(links_table) == LUA_TTABLE) {
+        for(uint32_t i = 1; luabind::type(links_table[i]) == LUA_TTABLE; ++i) {
+            luabind::object link_table = links_table[i];
+            std::string from = _ReadGraphString(link_table, "from");
+
+            EventGraphLink link;
+            link.child_event_id = _ReadGraphString(link_table, "to");
+            link.launch_at_start = _ReadGraphBool(link_table, "at_start", false);
+            link.launch_time = static_cast<uint32_t>(_ReadGraphNumber(link_table, "delay", 0.0f));
+            link.child_index = -1;
+
+            std::map<std::string, uint32_t>::const_iterator parent = node_indices.find(from);
+            if(parent == node_indices.end()) {
+                PRINT_WARNING << "Event graph link #" << i << " starts from an event not in the graph: '"
+                              << from << "' in map script: " << map_filename << std::endl;
+                return false;
+            }
+
+            std::map<std::string, uint32_t>::const_iterator child = node_indices.find(link.child_event_id);
+            if(child != node_indices.end()) {
+                link.child_index = static_cast<int32_t>(child->second);
+            } else if(!DoesEventExist(link.child_event_id)) {
+                PRINT_WARNING << "Event graph link #" << i << " points to an unknown event: '"
+                              << link.child_event_id << "' in map script: " << map_filename << std::endl;
+                return false;
+            }
+
+            nodes[parent->second - first_node].links.push_back(link);
+        }
+    }
+
+    // Check for cycles. The nodes are temporarily appended so that their indices are valid.
+    _event_graph_nodes.insert(_event_graph_nodes.end(), nodes.begin(), nodes.end());
+    std::vector<uint8_t> states(nodes.size(), 0);
+    for(uint32_t i = 0; i < nodes.size(); ++i) {
+        if(states[i] == 0 && _HasGraphCycle(_event_graph_nodes, first_node, first_node + i, states)) {
+            PRINT_WARNING << "The event graph contains a cycle through event: '" << nodes[i].event_id
+                          << "' in map script: " << map_filename << std::endl;
+            _event_graph_nodes.resize(first_node);
+            return false;
+        }
+    }
+
+    // Create the events
+    std::vector<MapEvent*> events;
+    for(uint32_t i = 0; i < nodes.size(); ++i) {
+        MapEvent* event = _CreateGraphEvent(node_tables[i], nodes[i].event_id, node_types[i]);
+        if(event == nullptr) {
+            // Shouldn't happen as the nodes were checked beforehand.
+            PRINT_ERROR << "Couldn't create the event graph node: '" << nodes[i].event_id << "' of type: '"
+                        << node_types[i] << "' in map script: " << map_filename << std::endl;
+            _event_graph_nodes.resize(first_node);
+            return false;
+        }
+        _event_graph_nodes[first_node + i].event_type = event->GetEventType();
+        events.push_back(event);
+    }
+
+    // And link them together, directly through their pointers when inside the graph.
+    for(uint32_t i = 0; i < nodes.size(); ++i) {
+        const std::vector<EventGraphLink>& links = nodes[i].links;
+        for(uint32_t j = 0; j < links.size(); ++j) {
+            EventLink event_link(links[j].child_event_id, links[j].launch_at_start, links[j].launch_time);
+            if(links[j].child_index >= 0)
+                event_link.child_event = events[links[j].child_index - first_node];
+            events[i]->_event_links.push_back(event_link);
+        }
+    }
+
+    return true;
+}
+
 void EventSupervisor::_ExamineEventLinks(MapEvent *parent_event, bool event_start)
 {
     for(uint32_t i = 0; i < parent_event->_event_links.size(); ++i) {
@@ -1414,23 +1814,26 @@ void EventSupervisor::_ExamineEventLinks(MapEvent *parent_event, bool event_star
         if(link.launch_at_start != event_start) {
             continue;
         }
+
+        // Resolve the child event only once
+        if(link.child_event == nullptr)
+            link.child_event = GetEvent(link.child_event_id);
+
+        if(link.child_event == nullptr) {
+            PRINT_WARNING << "Couldn't launch child event, no event with this ID existed: '"
+                          << link.child_event_id << "' from parent event ID: '"
+                          << parent_event->GetEventID()
+                          << "' in map script: "
+                          << MapMode::CurrentInstance()->GetMapScriptFilename() << std::endl;
+            continue;
+        }
         // Case 2: The child event is to be launched immediately
         else if(link.launch_timer == 0) {
-            StartEvent(link.child_event_id);
+            StartEvent(link.child_event);
         }
         // Case 3: The child event has a timer associated with it and needs to be placed in the event launch container
         else {
-            MapEvent *child = GetEvent(link.child_event_id);
-            if(child == nullptr) {
-                PRINT_WARNING << "Couldn't launch child event, no event with this ID existed: '"
-                              << link.child_event_id << "' from parent event ID: '"
-                              << parent_event->GetEventID()
-                              << "' in map script: "
-                              << MapMode::CurrentInstance()->GetMapScriptFilename() << std::endl;
-                continue;
-            } else {
-                _active_delayed_events.push_back(std::make_pair(static_cast<int32_t>(link.launch_timer), child));
-            }
+            _active_delayed_events.push_back(std::make_pair(static_cast<int32_t>(link.launch_timer), link.child_event));
         }
     }
 }
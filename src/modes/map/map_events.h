@@ -43,6 +43,7 @@ class SpriteDialogue;
 class VirtualSprite;
 
 struct BattleEnemyInfo;
+class MapEvent;
 
 /** ****************************************************************************
 *** \brief A container class representing a link between two map events
@@ -67,7 +68,7 @@ class EventLink
 {
 public:
     EventLink(const std::string &child_id, bool start, uint32_t time) :
-        child_event_id(child_id), launch_at_start(start), launch_timer(time) {}
+        child_event_id(child_id), child_event(nullptr), launch_at_start(start), launch_timer(time) {}
 
     ~EventLink()
     {}
@@ -75,6 +76,9 @@ public:
     //! \brief The ID of the child event in this link
     std::string child_event_id;
 
+    //! \brief The child event, resolved from its ID the first time the link is used
+    MapEvent* child_event;
+
     //! \brief The event will launch relative to the parent event's start if true, or its finish if false
     bool launch_at_start;
 
@@ -554,6 +558,9 @@ public:
                            const std::string& on_false_event);
 
 protected:
+    //! \brief The name of the check function, until it is bound at the first event start
+    std::string _check_function_name;
+
     //! \brief A pointer to the Lua function that starts the event
     luabind::object _check_function;
 
@@ -606,6 +613,17 @@ public:
                                  const std::string& update_function);
 
 protected:
+    /** \name Function names
+    *** The map functions are only bound when the event starts for the first time.
+    **/
+    //@{
+    std::string _start_function_name;
+    std::string _update_function_name;
+    //@}
+
+    //! \brief Tells whether the start and update function names have been bound to Lua functions
+    bool _functions_bound;
+
     //! \brief A pointer to the Lua function that starts the event
     luabind::object _start_function;
 
@@ -631,9 +649,13 @@ protected:
 *** it notifies the sprite object which grabs a pointer to the SpriteEvent.
 ***
 *** For a deriving class to be implemented properly, it must do two things.
-*** # In the _Start method, call SpriteEvent::_Start() before any other code
+*** # In the _Start method, call SpriteEvent::_Start() before any other code,
+*** and return when _sprite is nullptr afterwards
+*** # In the _Update() method, return true when _ResolveSprite() fails before any other code
 *** # Before returning true in the _Update() method, call _sprite->ReleaseControl(this)
 ***
+*** The sprite is kept as a handle, since it may be deleted while the event is pending.
+***
 *** \note It is important to keep in mind that all map sprites have their update
 *** function called before map events are updated. This can have implications for
 *** changing some members of the sprite object inside the _Start() and _Update() methods
@@ -653,17 +675,24 @@ public:
     {
     }
 
-    VirtualSprite* GetSprite() const {
-        return _sprite;
-    }
+    //! \brief Returns the sprite that the event controls, or nullptr if it was deleted.
+    VirtualSprite* GetSprite() const;
 
     //! \brief Frees the sprite from the control_event
     virtual void Terminate();
 
 protected:
-    //! \brief A pointer to the map sprite that the event controls
+    //! \brief The handle of the map sprite that the event controls
+    MapObjectHandle _sprite_handle;
+
+    //! \brief The map sprite that the event controls, as resolved by _Start() and _ResolveSprite().
     VirtualSprite* _sprite;
 
+    /** \brief Resolves _sprite from its handle
+    *** \return false, with a warning, if the sprite was deleted. The event should end then.
+    **/
+    bool _ResolveSprite();
+
     /** \brief Starts a sprite event.
     ***
     *** This method will make sure no other sprite event is operating the current sprite
@@ -713,6 +742,17 @@ public:
                                        const std::string& start_function, const std::string& update_function);
 
 protected:
+    /** \name Function names
+    *** The map functions are only bound when the event starts for the first time.
+    **/
+    //@{
+    std::string _start_function_name;
+    std::string _update_function_name;
+    //@}
+
+    //! \brief Tells whether the start and update function names have been bound to Lua functions
+    bool _functions_bound;
+
     //! \brief A pointer to the Lua function that starts the event
     luabind::object _start_function;
 
@@ -817,12 +857,12 @@ protected:
     //! \brief Retains the position to look at when the event starts.
     float _x, _y;
 
-    /** \brief Retains the position to look at when the even starts.
+    /** \brief Retains the sprite to look at when the even starts.
     *** \note The event will take the sprite coord only at _Start() call, since
     *** the position may have changed between the event declaration (map load time)
-    *** and its start.
+    *** and its start. A handle is kept since the sprite may have been deleted in between.
     **/
-    VirtualSprite* _target_sprite;
+    MapObjectHandle _target_sprite;
 
     //! \brief Immediately changes the sprite's direction
     void _Start();
@@ -903,7 +943,8 @@ protected:
     float _destination_x, _destination_y;
 
     //! \brief The destination target, useful when willing to reach a moving point.
-    VirtualSprite* _target_sprite;
+    //! A handle is kept since the sprite may have been deleted before the event start.
+    MapObjectHandle _target_sprite;
 
     //! \brief Used to store the previous coordinates of the sprite during path movement, so as to set the proper direction of the sprite as it moves
     float _last_x_position, _last_y_position;
@@ -1034,9 +1075,6 @@ protected:
     //! The custom animation time.
     int32_t _animation_time;
 
-    //! A reference to the map sprite object
-    MapSprite* _map_sprite;
-
     //! \brief Triggers the custom animation for the given time
     void _Start();
 
@@ -1105,6 +1143,37 @@ protected:
     bool _Update();
 }; // class TreasureEvent : public MapEvent
 
+/** ****************************************************************************
+*** \brief A link between two nodes of an event graph
+*** ***************************************************************************/
+struct EventGraphLink {
+    //! \brief The index of the child node in the graph nodes, or -1 when linking to an event outside of the graph
+    int32_t child_index;
+
+    //! \brief The ID of the child event
+    std::string child_event_id;
+
+    //! \brief The child launches relative to the parent event's start if true, or its finish if false
+    bool launch_at_start;
+
+    //! \brief The amount of milliseconds to wait before launching the child event
+    uint32_t launch_time;
+};
+
+/** ****************************************************************************
+*** \brief A node of an event graph, as loaded by EventSupervisor::LoadEventGraph()
+*** ***************************************************************************/
+struct EventGraphNode {
+    //! \brief The ID of the event created from this node
+    std::string event_id;
+
+    //! \brief The type of the event created from this node
+    EVENT_TYPE event_type;
+
+    //! \brief The node children
+    std::vector<EventGraphLink> links;
+};
+
 /** ****************************************************************************
 *** \brief Manages, processes, and launches map events
 ***
@@ -1222,16 +1291,62 @@ public:
     /** \brief Returns a pointer to a specified event stored by this class
     *** \param event_id The ID of the event to retrieve
     *** \return A MapEvent pointer (which may need to be casted to the proper event type), or nullptr if no event was found
+    *** \note A declared event not created yet is created by this call.
     **/
-    MapEvent* GetEvent(const std::string& event_id) const;
+    MapEvent* GetEvent(const std::string& event_id);
 
-    bool DoesEventExist(const std::string& event_id) const
-    { return !(GetEvent(event_id) == nullptr); }
+    //! \brief Tells whether the event exists or is declared, without creating it.
+    bool DoesEventExist(const std::string& event_id) const;
+
+    /** \brief Declares an event that will only be created when first needed.
+    *** \param event_id The ID of the declared event
+    *** \param create_function The name of the map function creating the event, and usually its whole
+    *** event chain along with its dialogues. It is called with the event id as parameter
+    *** the first time the event is started or reached through an event link.
+    *** This permits story-dense maps to avoid creating and translating events never triggered.
+    **/
+    void DeclareEvent(const std::string& event_id, const std::string& create_function);
+
+    /** \brief Creates all the events of a declarative event graph.
+    *** \param graph A Lua table of the following form:
+    *** {
+    ***     nodes = {
+    ***         { id = "Kalya goes home", type = "path_move", sprite = kalya, x = 52, y = 47, run = true },
+    ***         { id = "End of scene", type = "scripted", start = "end_scene" },
+    ***     },
+    ***     links = {
+    ***         { from = "Kalya goes home", to = "End of scene", at_start = false, delay = 1000 },
+    ***     }
+    *** }
+    *** Node types and their parameters are: scripted (start, update), scripted_sprite (sprite, start, update),
+    *** dialogue (dialogue, stop_camera), sound (filename), map_transition (data_file, script_file, coming_from),
+    *** change_direction (sprite, direction), look_at (sprite, target or x and y),
+    *** path_move (sprite, target or x and y, run), random_move (sprite, move_time, direction_time),
+    *** animate (sprite, animation, time) and if (check, on_true, on_false).
+    *** Links may point to events existing or declared outside of the graph.
+    *** \return false, without creating any event, if a node is invalid, if a link points to an unknown
+    *** event, or if the graph links contain a cycle.
+    **/
+    bool LoadEventGraph(const luabind::object& graph);
+
+    //! \brief Returns the nodes of every event graph loaded, in load order.
+    const std::vector<EventGraphNode>& GetEventGraphNodes() const {
+        return _event_graph_nodes;
+    }
 
 private:
     //! \brief A container for all map events, where the event's ID serves as the key to the std::map
     std::map<std::string, MapEvent*> _all_events;
 
+    //! \brief The declared events not created yet, with the name of their creation map function.
+    std::map<std::string, std::string> _declared_events;
+
+    //! \brief Calls the creation function of a declared event and returns the created event, or nullptr.
+    MapEvent* _CreateDeclaredEvent(const std::string& event_id);
+
+    //! \brief The nodes of all the loaded event graphs, linked through their indices.
+    std::vector<EventGraphNode> _event_graph_nodes;
+
     //! \brief A list of all events which have started but are not yet finished
     std::vector<MapEvent*> _active_events;
 
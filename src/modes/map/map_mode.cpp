@@ -463,6 +463,31 @@ void MapMode::DeleteMapObject(private_map::MapObject* object)
     _object_supervisor->DeleteObject(object);
 }
 
+MapObject* MapMode::GetMapObject(const MapObjectHandle& handle)
+{
+    return _object_supervisor->GetObject(handle);
+}
+
+void MapMode::DespawnMapObject(MapObject* object)
+{
+    _object_supervisor->DespawnObject(object);
+}
+
+void MapMode::SpawnMapObject(MapObject* object)
+{
+    _object_supervisor->SpawnObject(object);
+}
+
+void MapMode::ReleaseMapObjectToPool(const std::string& pool_name, MapObject* object)
+{
+    _object_supervisor->ReleaseToPool(pool_name, object);
+}
+
+MapObject* MapMode::AcquireMapObjectFromPool(const std::string& pool_name)
+{
+    return _object_supervisor->AcquireFromPool(pool_name);
+}
+
 void MapMode::SetCamera(private_map::VirtualSprite *sprite, uint32_t duration)
 {
     if(_camera == sprite) {
@@ -696,6 +721,12 @@ bool MapMode::_Load()
 
     _update_function = _map_script.ReadFunctionPointer("Update");
 
+    // Now that the camera is set, load the tile chunks around it while still loading.
+    if(!_tile_supervisor->_chunk_directory.empty()) {
+        _UpdateMapFrame();
+        _tile_supervisor->_UpdateChunks(true);
+    }
+
     return true;
 } // bool MapMode::_Load()
 
@@ -923,8 +954,8 @@ void MapMode::_UpdateMapFrame()
     uint16_t current_x = GetFloatInteger(camera_x);
     uint16_t current_y = GetFloatInteger(camera_y);
 
-    // Update the pixel length.
-    VideoManager->GetPixelSize(_pixel_length_x, _pixel_length_y);
+    // Update the pixel length, the map being drawn at the secondary render target resolution.
+    VideoManager->GetSecondaryRenderTargetPixelSize(_pixel_length_x, _pixel_length_y);
     _pixel_length_x /= GRID_LENGTH;
     _pixel_length_y /= GRID_LENGTH;
 
@@ -1084,18 +1115,11 @@ void MapMode::_DrawMapLayers()
     VideoManager->PushState();
     VideoManager->SetStandardCoordSys();
 
+    // The map's tiles and objects are drawn at the internal resolution
+    // into the secondary render target, whatever the screen resolution is.
     VideoManager->EnableSecondaryRenderTarget();
     VideoManager->Clear();
 
-    //
-    // TODO: Draw the map's tiles and objects at their
-    //       native resolutions into the secondary render
-    //       target.
-    //
-    //       Currently, everything is drawn at their final
-    //       resolutions.
-    //
-
     _tile_supervisor->DrawLayers(&_map_frame, GROUND_LAYER);
 
     // Save points are engraved on the ground, and thus shouldn't be drawn after walls.
@@ -1120,15 +1144,7 @@ void MapMode::_DrawMapLayers()
 
     VideoManager->PopState();
 
-    //
-    // TODO: Draw the composited, native resolution map
-    //       onto the primary render target with the appropriate
-    //       scale factor and offsets.
-    //
-    //       Currently, the secondary render target is treated
-    //       identically to a full screen quad.
-    //
-
+    // Scale the composited map onto the screen, once.
     VideoManager->DrawSecondaryRenderTarget();
 }
 
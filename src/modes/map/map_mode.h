@@ -159,6 +159,23 @@ public:
     //! \brief Removes an object from memory
     void DeleteMapObject(private_map::MapObject* obj);
 
+    //! \brief Returns the object referred to by the handle, or nullptr if it was deleted
+    private_map::MapObject* GetMapObject(const private_map::MapObjectHandle& handle);
+
+    //! \brief Detaches an object from the map without deleting it, and attaches it back.
+    //! \see ObjectSupervisor::DespawnObject(), ObjectSupervisor::SpawnObject()
+    //@{
+    void DespawnMapObject(private_map::MapObject* object);
+    void SpawnMapObject(private_map::MapObject* object);
+    //@}
+
+    //! \brief Despawns an object and keeps it in the given pool, and takes it back from there.
+    //! \see ObjectSupervisor::ReleaseToPool(), ObjectSupervisor::AcquireFromPool()
+    //@{
+    void ReleaseMapObjectToPool(const std::string& pool_name, private_map::MapObject* object);
+    private_map::MapObject* AcquireMapObjectFromPool(const std::string& pool_name);
+    //@}
+
     //! \brief Vectors containing the save points animations (when the character is in or not).
     std::vector<vt_video::AnimatedImage> active_save_point_animations;
     std::vector<vt_video::AnimatedImage> inactive_save_point_animations;
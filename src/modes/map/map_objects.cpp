@@ -48,6 +48,7 @@ namespace private_map
 
 MapObject::MapObject(MapObjectDrawLayer layer) :
     _object_id(-1),
+    _generation(0),
     _img_pixel_half_width(0.0f),
     _img_pixel_height(0.0f),
     _img_screen_half_width(0.0f),
@@ -71,12 +72,14 @@ MapObject::MapObject(MapObjectDrawLayer layer) :
     _emote_screen_offset_y(0.0f),
     _emote_time(0),
     _draw_layer(layer),
-    _grayscale(false)
+    _grayscale(false),
+    _update_policy(UPDATE_ALWAYS),
+    _culled_time(0)
 {
     // Generate the object Id at creation time.
     ObjectSupervisor* obj_sup = MapMode::CurrentInstance()->GetObjectSupervisor();
     _object_id = obj_sup->GenerateObjectID();
-    obj_sup->RegisterObject(this);
+    _generation = obj_sup->RegisterObject(this);
 }
 
 MapObject::~MapObject()
@@ -91,6 +94,39 @@ void MapObject::Update()
         _interaction_icon->Update();
 }
 
+//! \brief Fast-forwards an animation by the time skipped while its object was culled.
+static void _CatchUpAnimation(AnimatedImage& animation, uint32_t elapsed_time)
+{
+    // Only the position within the animation loop matters: skip the whole loops.
+    uint32_t loop_time = animation.GetAnimationLength();
+    if(loop_time > 0)
+        elapsed_time %= loop_time;
+
+    // Updating with 0 would use the last update time instead.
+    if(elapsed_time > 0)
+        animation.Update(elapsed_time);
+}
+
+void MapObject::CullableUpdate(const MapRectangle& update_area)
+{
+    _UpdateEvenWhenCulled();
+
+    if(_update_policy != UPDATE_ALWAYS && !IsUpdateForced()
+            && !MapRectangle::CheckIntersection(GetGridImageRectangle(), update_area)) {
+        // Keep track of the skipped time so the object can catch up once back.
+        if(_update_policy == UPDATE_CATCH_UP_WHEN_CULLED)
+            _culled_time += SystemManager->GetUpdateTime();
+        return;
+    }
+
+    if(_culled_time > 0) {
+        _CatchUp(_culled_time);
+        _culled_time = 0;
+    }
+
+    Update();
+}
+
 bool MapObject::ShouldDraw()
 {
     if(!_visible)
@@ -288,6 +324,7 @@ PhysicalObject::PhysicalObject(MapObjectDrawLayer layer) :
     _current_animation_id(0)
 {
     _object_type = PHYSICAL_TYPE;
+    _update_policy = UPDATE_CATCH_UP_WHEN_CULLED;
 }
 
 PhysicalObject::~PhysicalObject()
@@ -309,6 +346,12 @@ void PhysicalObject::Update()
         _animations[_current_animation_id].Update();
 }
 
+void PhysicalObject::_CatchUp(uint32_t elapsed_time)
+{
+    if(!_animations.empty() && _updatable)
+        _CatchUpAnimation(_animations[_current_animation_id], elapsed_time);
+}
+
 void PhysicalObject::Draw()
 {
     if(_animations.empty() || !MapObject::ShouldDraw())
@@ -371,6 +414,8 @@ ParticleObject::ParticleObject(const std::string& filename, float x, float y, Ma
     _tile_position.y = y;
 
     _object_type = PARTICLE_TYPE;
+    // Ambient particles simply resume once back in view.
+    _update_policy = UPDATE_PAUSE_WHEN_CULLED;
     _collision_mask = NO_COLLISION;
 
     _particle_effect = new vt_mode_manager::ParticleEffect(filename);
@@ -542,6 +587,7 @@ Halo::Halo(const std::string& filename, float x, float y, const Color& color):
     _tile_position.y = y;
 
     _object_type = HALO_TYPE;
+    _update_policy = UPDATE_CATCH_UP_WHEN_CULLED;
     _collision_mask = NO_COLLISION;
 
     if(!_animation.LoadFromAnimationScript(filename))
@@ -570,6 +616,12 @@ void Halo::Update()
         _animation.Update();
 }
 
+void Halo::_CatchUp(uint32_t elapsed_time)
+{
+    if(_updatable)
+        _CatchUpAnimation(_animation, elapsed_time);
+}
+
 void Halo::Draw()
 {
     if(MapObject::ShouldDraw() && _animation.GetCurrentFrame())
@@ -589,6 +641,8 @@ Light::Light(const std::string &main_flare_filename,
     _tile_position.y = y;
 
     _object_type = LIGHT_TYPE;
+    // The light orientation is recomputed anyway once back in view.
+    _update_policy = UPDATE_PAUSE_WHEN_CULLED;
     _collision_mask = NO_COLLISION;
 
     _a = _b = 0.0f;
@@ -756,6 +810,7 @@ SoundObject::SoundObject(const std::string& sound_filename, float x, float y, fl
             << sound_filename << std::endl;
     }
 
+    _sound.SetBus(vt_audio::AUDIO_BUS_AMBIENCE);
     _sound.SetLooping(true);
     _sound.SetVolume(0.0f);
     _sound.Stop();
@@ -882,6 +937,8 @@ TreasureObject::TreasureObject(const std::string &treasure_name,
     PhysicalObject(layer)
 {
     _object_type = TREASURE_TYPE;
+    // The opening state and events must be handled wherever the treasure is.
+    _update_policy = UPDATE_ALWAYS;
     _events_triggered = false;
     _is_opening = false;
 
@@ -1030,6 +1087,7 @@ TriggerObject::TriggerObject(const std::string &trigger_name,
     _trigger_state(false)
 {
     _object_type = TRIGGER_TYPE;
+    _update_policy = UPDATE_ALWAYS;
 
     _trigger_name = trigger_name;
 
@@ -1144,14 +1202,16 @@ ObjectSupervisor::ObjectSupervisor() :
     _num_grid_x_axis(0),
     _num_grid_y_axis(0),
     _last_id(1), //! Every object Id must be > 0 since 0 is reserved for speakerless dialogues.
-    _visible_party_member(nullptr)
+    _number_objects(0),
+    _visible_party_member(nullptr),
+    _is_updating(false)
 {}
 
 ObjectSupervisor::~ObjectSupervisor()
 {
     // Delete all the map objects
-    for(uint32_t i = 0; i < _all_objects.size(); ++i) {
-        delete(_all_objects[i]);
+    for(uint32_t i = 0; i < _object_slots.size(); ++i) {
+        delete(_object_slots[i].object);
     }
 
     for(uint32_t i = 0; i < _zones.size(); ++i) {
@@ -1159,12 +1219,47 @@ ObjectSupervisor::~ObjectSupervisor()
     }
 }
 
+uint16_t ObjectSupervisor::GenerateObjectID()
+{
+    if(!_free_object_ids.empty()) {
+        uint16_t object_id = _free_object_ids.back();
+        _free_object_ids.pop_back();
+        return object_id;
+    }
+    return ++_last_id;
+}
+
 MapObject* ObjectSupervisor::GetObject(uint32_t object_id)
 {
-    if(object_id >= _all_objects.size())
+    if(object_id >= _object_slots.size())
         return nullptr;
     else
-        return _all_objects[object_id];
+        return _object_slots[object_id].object;
+}
+
+MapObject* ObjectSupervisor::GetObject(const MapObjectHandle& handle)
+{
+    if(!IsValidHandle(handle))
+        return nullptr;
+    return _object_slots[handle.id].object;
+}
+
+VirtualSprite* ObjectSupervisor::GetSprite(const MapObjectHandle& handle)
+{
+    MapObject* object = GetObject(handle);
+    if(object == nullptr)
+        return nullptr;
+
+    return dynamic_cast<VirtualSprite *>(object);
+}
+
+bool ObjectSupervisor::IsValidHandle(const MapObjectHandle& handle) const
+{
+    if(handle.IsNull() || handle.id >= _object_slots.size())
+        return false;
+
+    const ObjectSlot& slot = _object_slots[handle.id];
+    return slot.object != nullptr && slot.generation == handle.generation;
 }
 
 VirtualSprite* ObjectSupervisor::GetSprite(uint32_t object_id)
@@ -1183,36 +1278,24 @@ VirtualSprite* ObjectSupervisor::GetSprite(uint32_t object_id)
     return sprite;
 }
 
-void ObjectSupervisor::RegisterObject(MapObject* object)
+uint16_t ObjectSupervisor::RegisterObject(MapObject* object)
 {
     if (!object || object->GetObjectID() <= 0) {
         PRINT_WARNING << "The object couldn't be registered. It is either nullptr or with an id <= 0." << std::endl;
-        return;
+        return 0;
     }
 
     uint32_t obj_id = (uint32_t)object->GetObjectID();
-    // Adds the object to the all object collection.
-    if (obj_id >= _all_objects.size())
-        _all_objects.resize(obj_id + 1, nullptr);
-    _all_objects[obj_id] = object;
+    // Adds the object to the object table.
+    if (obj_id >= _object_slots.size())
+        _object_slots.resize(obj_id + 1);
+    ObjectSlot& slot = _object_slots[obj_id];
+    slot.object = object;
+    ++_number_objects;
 
-    switch(object->GetObjectDrawLayer()) {
-    case FLATGROUND_OBJECT:
-        _flat_ground_objects.push_back(object);
-        break;
-    case GROUND_OBJECT:
-        _ground_objects.push_back(object);
-        break;
-    case PASS_OBJECT:
-        _pass_objects.push_back(object);
-        break;
-    case SKY_OBJECT:
-        _sky_objects.push_back(object);
-        break;
-    case NO_LAYER_OBJECT:
-    default: // Nothing to do. the object is registered in all objects only.
-        break;
-    }
+    SpawnObject(object);
+
+    return slot.generation;
 }
 
 void ObjectSupervisor::AddAmbientSound(SoundObject* object)
@@ -1269,54 +1352,168 @@ void ObjectSupervisor::DeleteObject(MapObject* object)
     if (!object)
         return;
 
-    for (uint32_t i = 0; i < _all_objects.size(); ++i) {
-        // We only set it to null without removing its place in memory
-        // to avoid breaking the vector key used as object id,
-        // so that in: _all_objects[key]: key = object_id.
-        if (_all_objects[i] == object) {
-            _all_objects[i] = nullptr;
-            break;
-        }
+    ObjectSlot* slot = _GetObjectSlot(object);
+    if (!slot) {
+        PRINT_WARNING << "Tried to delete an object not registered in the object supervisor: "
+                      << object->GetObjectID() << std::endl;
+        return;
     }
+    if (slot->spawned || slot->despawn_pending)
+        _RemoveFromLayer(*slot);
 
-    std::vector<MapObject*>::iterator it;
-    std::vector<MapObject*>::iterator it_end;
-    std::vector<MapObject*>* to_iterate = nullptr;
+    // The slot gets a new generation so that the remaining handles to the object become invalid.
+    slot->object = nullptr;
+    ++slot->generation;
+    _free_object_ids.push_back(object->GetObjectID());
+    --_number_objects;
 
-    switch(object->GetObjectDrawLayer()) {
-    case FLATGROUND_OBJECT:
-        it = _flat_ground_objects.begin();
-        it_end = _flat_ground_objects.end();
-        to_iterate = &_flat_ground_objects;
-        break;
-    case GROUND_OBJECT:
-        it = _ground_objects.begin();
-        it_end = _ground_objects.end();
-        to_iterate = &_ground_objects;
-        break;
-    case PASS_OBJECT:
-        it = _pass_objects.begin();
-        it_end = _pass_objects.end();
-        to_iterate = &_pass_objects;
-        break;
-    case SKY_OBJECT:
-        it = _sky_objects.begin();
-        it_end = _sky_objects.end();
-        to_iterate = &_sky_objects;
-        break;
-    case NO_LAYER_OBJECT:
-    default:
-        delete object;
+    delete object;
+}
+
+void ObjectSupervisor::DespawnObject(MapObject* object)
+{
+    ObjectSlot* slot = _GetObjectSlot(object);
+    if (!slot) {
+        IF_PRINT_WARNING(MAP_DEBUG) << "Tried to despawn an object not registered in the object supervisor." << std::endl;
         return;
     }
 
-    for(; it != it_end; ++it) {
-        if (*it == object) {
-            to_iterate->erase(it);
-            break;
-        }
+    // Lights, halos, save points and sound objects are updated and drawn from their own containers.
+    if (!_GetLayerContainer(object->GetObjectDrawLayer())) {
+        PRINT_WARNING << "Objects without draw layer can't be despawned, object id: "
+                      << object->GetObjectID() << std::endl;
+        return;
     }
-    delete object;
+
+    if (!slot->spawned)
+        return;
+
+    // Removing the object from its layer would shift the objects being updated.
+    if (_is_updating) {
+        slot->spawned = false;
+        slot->despawn_pending = true;
+        _pending_despawn_ids.push_back(object->GetObjectID());
+        return;
+    }
+
+    _RemoveFromLayer(*slot);
+}
+
+void ObjectSupervisor::SpawnObject(MapObject* object)
+{
+    ObjectSlot* slot = _GetObjectSlot(object);
+    if (!slot) {
+        IF_PRINT_WARNING(MAP_DEBUG) << "Tried to spawn an object not registered in the object supervisor." << std::endl;
+        return;
+    }
+
+    if (slot->spawned)
+        return;
+    slot->spawned = true;
+
+    // The object despawned during this update is still in its draw layer.
+    if (slot->despawn_pending) {
+        slot->despawn_pending = false;
+        return;
+    }
+
+    // Objects without draw layer are only registered in the object table.
+    std::vector<MapObject*>* layer_objects = _GetLayerContainer(object->GetObjectDrawLayer());
+    if (layer_objects) {
+        slot->layer_index = layer_objects->size();
+        layer_objects->push_back(object);
+    }
+}
+
+bool ObjectSupervisor::IsObjectSpawned(const MapObject* object) const
+{
+    if (!object)
+        return false;
+
+    uint32_t obj_id = (uint32_t)object->GetObjectID();
+    if (obj_id >= _object_slots.size() || _object_slots[obj_id].object != object)
+        return false;
+    return _object_slots[obj_id].spawned;
+}
+
+void ObjectSupervisor::ReleaseToPool(const std::string& pool_name, MapObject* object)
+{
+    if (!_GetObjectSlot(object)) {
+        PRINT_WARNING << "Tried to release an object not registered in the object supervisor to pool: "
+                      << pool_name << std::endl;
+        return;
+    }
+
+    if (!_GetLayerContainer(object->GetObjectDrawLayer())) {
+        PRINT_WARNING << "Objects without draw layer can't be released to pool: " << pool_name << std::endl;
+        return;
+    }
+
+    DespawnObject(object);
+
+    // Releasing an object twice would let it be acquired twice.
+    std::vector<MapObjectHandle>& pool = _object_pools[pool_name];
+    const MapObjectHandle handle = object->GetHandle();
+    if (std::find(pool.begin(), pool.end(), handle) == pool.end())
+        pool.push_back(handle);
+}
+
+MapObject* ObjectSupervisor::AcquireFromPool(const std::string& pool_name)
+{
+    std::map<std::string, std::vector<MapObjectHandle> >::iterator it = _object_pools.find(pool_name);
+    if (it == _object_pools.end())
+        return nullptr;
+
+    std::vector<MapObjectHandle>& pool = it->second;
+    while (!pool.empty()) {
+        MapObject* object = GetObject(pool.back());
+        pool.pop_back();
+
+        // Skip the objects deleted or spawned again since they were released.
+        if (object && !IsObjectSpawned(object))
+            return object;
+    }
+    return nullptr;
+}
+
+ObjectSupervisor::ObjectSlot* ObjectSupervisor::_GetObjectSlot(const MapObject* object)
+{
+    if (!object)
+        return nullptr;
+
+    // Object copies share the id of the original object, but aren't registered.
+    uint32_t obj_id = (uint32_t)object->GetObjectID();
+    if (obj_id >= _object_slots.size() || _object_slots[obj_id].object != object)
+        return nullptr;
+    return &_object_slots[obj_id];
+}
+
+void ObjectSupervisor::_RemoveFromLayer(ObjectSlot& slot)
+{
+    slot.spawned = false;
+    slot.despawn_pending = false;
+
+    std::vector<MapObject*>* layer_objects = _GetLayerContainer(slot.object->GetObjectDrawLayer());
+    if (!layer_objects)
+        return;
+
+    // Move the last object of the layer in place of the removed one.
+    // The draw order is restored when the objects are sorted again.
+    MapObject* last_object = layer_objects->back();
+    (*layer_objects)[slot.layer_index] = last_object;
+    _object_slots[last_object->GetObjectID()].layer_index = slot.layer_index;
+    layer_objects->pop_back();
+}
+
+void ObjectSupervisor::_RemovePendingDespawns()
+{
+    for (uint32_t i = 0; i < _pending_despawn_ids.size(); ++i) {
+        // Objects spawned again or deleted meanwhile are no longer pending.
+        ObjectSlot& slot = _object_slots[_pending_despawn_ids[i]];
+        if (slot.despawn_pending)
+            _RemoveFromLayer(slot);
+    }
+    _pending_despawn_ids.clear();
 }
 
 void ObjectSupervisor::SortObjects()
@@ -1325,6 +1522,17 @@ void ObjectSupervisor::SortObjects()
     std::sort(_ground_objects.begin(), _ground_objects.end(), MapObject_Ptr_Less());
     std::sort(_pass_objects.begin(), _pass_objects.end(), MapObject_Ptr_Less());
     std::sort(_sky_objects.begin(), _sky_objects.end(), MapObject_Ptr_Less());
+
+    _UpdateLayerIndexes(_flat_ground_objects);
+    _UpdateLayerIndexes(_ground_objects);
+    _UpdateLayerIndexes(_pass_objects);
+    _UpdateLayerIndexes(_sky_objects);
+}
+
+void ObjectSupervisor::_UpdateLayerIndexes(const std::vector<MapObject*>& layer_objects)
+{
+    for(uint32_t i = 0; i < layer_objects.size(); ++i)
+        _object_slots[layer_objects[i]->GetObjectID()].layer_index = i;
 }
 
 bool ObjectSupervisor::Load(ReadScriptDescriptor &map_file)
@@ -1348,22 +1556,28 @@ bool ObjectSupervisor::Load(ReadScriptDescriptor &map_file)
 
 void ObjectSupervisor::Update()
 {
+    // Objects far from the camera are only updated according to their update policy.
+    const MapRectangle update_area = _GetUpdateArea();
+
+    _is_updating = true;
     for(uint32_t i = 0; i < _flat_ground_objects.size(); ++i)
-        _flat_ground_objects[i]->Update();
+        _flat_ground_objects[i]->CullableUpdate(update_area);
     for(uint32_t i = 0; i < _ground_objects.size(); ++i)
-        _ground_objects[i]->Update();
+        _ground_objects[i]->CullableUpdate(update_area);
     // Update save point animation and activeness.
     _UpdateSavePoints();
     for(uint32_t i = 0; i < _pass_objects.size(); ++i)
-        _pass_objects[i]->Update();
+        _pass_objects[i]->CullableUpdate(update_area);
     for(uint32_t i = 0; i < _sky_objects.size(); ++i)
-        _sky_objects[i]->Update();
+        _sky_objects[i]->CullableUpdate(update_area);
     for(uint32_t i = 0; i < _halos.size(); ++i)
-        _halos[i]->Update();
+        _halos[i]->CullableUpdate(update_area);
     for(uint32_t i = 0; i < _lights.size(); ++i)
-        _lights[i]->Update();
+        _lights[i]->CullableUpdate(update_area);
     for(uint32_t i = 0; i < _zones.size(); ++i)
         _zones[i]->Update();
+    _is_updating = false;
+    _RemovePendingDespawns();
 
     _UpdateAmbientSounds();
 }
@@ -1407,10 +1621,35 @@ void ObjectSupervisor::DrawSkyObjects()
 
 void ObjectSupervisor::DrawLights()
 {
-    for(uint32_t i = 0; i < _halos.size(); ++i)
+    // At full quality, every visible halo and light is drawn.
+    if(VideoManager->GetQualityLevel() == 0) {
+        for(uint32_t i = 0; i < _halos.size(); ++i)
+            _halos[i]->Draw();
+        for(uint32_t i = 0; i < _lights.size(); ++i)
+            _lights[i]->Draw();
+        return;
+    }
+
+    // Otherwise, only a limited number of them is drawn.
+    // Halos and lights have their own budget, so that many halos can't hide every light.
+    const float quality_factor = VideoManager->GetQualityFactor();
+    uint32_t max_halos = static_cast<uint32_t>(MAX_REDUCED_QUALITY_HALOS * quality_factor);
+    uint32_t drawn_halos = 0;
+    for(uint32_t i = 0; i < _halos.size() && drawn_halos < max_halos; ++i) {
+        if(!_halos[i]->ShouldDraw())
+            continue;
         _halos[i]->Draw();
-    for(uint32_t i = 0; i < _lights.size(); ++i)
+        ++drawn_halos;
+    }
+
+    uint32_t max_lights = static_cast<uint32_t>(MAX_REDUCED_QUALITY_LIGHTS * quality_factor);
+    uint32_t drawn_lights = 0;
+    for(uint32_t i = 0; i < _lights.size() && drawn_lights < max_lights; ++i) {
+        if(!_lights[i]->ShouldDraw())
+            continue;
         _lights[i]->Draw();
+        ++drawn_lights;
+    }
 }
 
 void ObjectSupervisor::DrawInteractionIcons()
@@ -1459,6 +1698,19 @@ void ObjectSupervisor::_UpdateSavePoints()
     }
 }
 
+MapRectangle ObjectSupervisor::_GetUpdateArea() const
+{
+    // The margin shrinks when the video engine lowers the quality,
+    // so that distant objects stop being animated sooner.
+    const float margin_factor = VideoManager->GetQualityFactor();
+    MapRectangle update_area = MapMode::CurrentInstance()->GetMapFrame().screen_edges;
+    update_area.left -= UPDATE_CULLING_MARGIN_X * margin_factor;
+    update_area.right += UPDATE_CULLING_MARGIN_X * margin_factor;
+    update_area.top -= UPDATE_CULLING_MARGIN_Y * margin_factor;
+    update_area.bottom += UPDATE_CULLING_MARGIN_Y * margin_factor;
+    return update_area;
+}
+
 void ObjectSupervisor::_UpdateAmbientSounds()
 {
     for(std::vector<SoundObject *>::iterator it = _sound_objects.begin();
@@ -1505,6 +1757,24 @@ std::vector<MapObject*>& ObjectSupervisor::_GetObjectsFromDrawLayer(MapObjectDra
     }
 }
 
+std::vector<MapObject*>* ObjectSupervisor::_GetLayerContainer(MapObjectDrawLayer layer)
+{
+    switch(layer)
+    {
+    case FLATGROUND_OBJECT:
+        return &_flat_ground_objects;
+    case GROUND_OBJECT:
+        return &_ground_objects;
+    case PASS_OBJECT:
+        return &_pass_objects;
+    case SKY_OBJECT:
+        return &_sky_objects;
+    case NO_LAYER_OBJECT:
+    default:
+        return nullptr;
+    }
+}
+
 MapObject *ObjectSupervisor::FindNearestInteractionObject(const VirtualSprite *sprite, float search_distance)
 {
     if(!sprite)
@@ -1912,9 +2182,10 @@ void ObjectSupervisor::ReloadVisiblePartyMember()
 
 void ObjectSupervisor::SetAllEnemyStatesToDead()
 {
-    for(uint32_t i = 0; i < _all_objects.size(); ++i) {
-        if (_all_objects[i] && _all_objects[i]->GetObjectType() == ENEMY_TYPE) {
-            EnemySprite* enemy = dynamic_cast<EnemySprite*>(_all_objects[i]);
+    for(uint32_t i = 0; i < _object_slots.size(); ++i) {
+        MapObject* object = _object_slots[i].object;
+        if (object && object->GetObjectType() == ENEMY_TYPE) {
+            EnemySprite* enemy = dynamic_cast<EnemySprite*>(object);
             enemy->ChangeStateDead();
         }
     }
@@ -53,6 +53,16 @@ enum MapObjectDrawLayer {
     NO_LAYER_OBJECT
 };
 
+//! \brief Used to know how an object is updated while it is far from the camera.
+enum MapObjectUpdatePolicy {
+    // The object is updated every frame, wherever it is.
+    UPDATE_ALWAYS = 0,
+    // The object isn't updated while culled, and resumes where it stopped once back.
+    UPDATE_PAUSE_WHEN_CULLED,
+    // The object isn't updated while culled, and fast-forwards the skipped time once back.
+    UPDATE_CATCH_UP_WHEN_CULLED
+};
+
 namespace private_map
 {
 
@@ -127,6 +137,22 @@ public:
     bool ShouldDraw();
     //@}
 
+    /** \brief Updates the object, unless it is culled according to its update policy.
+    *** \param update_area The map area, around the camera, where objects are always updated.
+    ***
+    *** Objects outside of the update area are skipped unless their policy is UPDATE_ALWAYS
+    *** or IsUpdateForced() returns true. Objects using UPDATE_CATCH_UP_WHEN_CULLED
+    *** receive the time skipped through _CatchUp() when they are updated again.
+    **/
+    void CullableUpdate(const MapRectangle& update_area);
+
+    /** \brief Tells whether the object must be updated even when culled.
+    *** Used by objects which state may change while away from the camera, e.g.: moving sprites.
+    **/
+    virtual bool IsUpdateForced() const {
+        return false;
+    }
+
     //! \brief Retrieves the object type identifier
     MAP_OBJECT_TYPE GetObjectType() const {
         return _object_type;
@@ -243,6 +269,10 @@ public:
         _draw_on_second_pass = pass;
     }
 
+    void SetUpdatePolicy(MapObjectUpdatePolicy policy) {
+        _update_policy = policy;
+    }
+
     //! \brief Tells the draw layer for faster deletion from the object supervisor.
     MapObjectDrawLayer GetObjectDrawLayer() const {
         return _draw_layer;
@@ -252,6 +282,11 @@ public:
         return _object_id;
     }
 
+    //! \brief Returns a handle to the object, which can be kept safely after the object deletion.
+    MapObjectHandle GetHandle() const {
+        return MapObjectHandle(_object_id, _generation);
+    }
+
     //! \brief Get the object position in tiles.
     MapPosition GetPosition() const {
         return _tile_position;
@@ -297,6 +332,10 @@ public:
         return _draw_on_second_pass;
     }
 
+    MapObjectUpdatePolicy GetUpdatePolicy() const {
+        return _update_policy;
+    }
+
     MAP_OBJECT_TYPE GetType() const {
         return _object_type;
     }
@@ -332,6 +371,9 @@ protected:
     **/
     int16_t _object_id;
 
+    //! \brief The generation of the object slot in the object supervisor, used by the object handles.
+    uint16_t _generation;
+
     /** \brief Coordinates for the object's origin/position.
     *** The origin of every map object is the bottom center point of the object. These
     *** origin coordinates are used to determine where the object is on the map as well
@@ -421,6 +463,25 @@ protected:
     //! \brief Tells whether the map object sprite and animation should be displayed grayscaled or not.
     bool _grayscale;
 
+    //! \brief Tells how the object is updated while far from the camera.
+    MapObjectUpdatePolicy _update_policy;
+
+    //! \brief The time skipped while the object was culled, in milliseconds.
+    uint32_t _culled_time;
+
+    /** \brief Fast-forwards the object state after it was culled.
+    *** \param elapsed_time The time skipped, in milliseconds.
+    *** Only called for objects using the UPDATE_CATCH_UP_WHEN_CULLED policy.
+    **/
+    virtual void _CatchUp(uint32_t /*elapsed_time*/)
+    {}
+
+    /** \brief Called every update, even when the object is culled.
+    *** Used for checks depending on a distance to the camera larger than the update area.
+    **/
+    virtual void _UpdateEvenWhenCulled()
+    {}
+
     //! \brief Takes care of updating the emote animation and state.
     void _UpdateEmote();
 
@@ -544,6 +605,10 @@ private:
 
     //! \brief The event id triggered when talking to the sprite.
     std::string _event_when_talking;
+
+protected:
+    //! \brief Fast-forwards the current animation.
+    virtual void _CatchUp(uint32_t elapsed_time) override;
 }; // class PhysicalObject : public MapObject
 
 /** ****************************************************************************
@@ -664,6 +729,8 @@ private:
     //! The blending color of the halo
     vt_video::Color _color;
 
+    //! \brief Fast-forwards the halo animation.
+    virtual void _CatchUp(uint32_t elapsed_time) override;
     //@}
 }; // class Halo : public MapObject
 
@@ -1040,13 +1107,12 @@ public:
 
     //! \brief Returns a unique ID integer for an object to use
     //! Every object Id must be > 0 since 0 is reserved for speakerless dialogues.
-    uint16_t GenerateObjectID() {
-        return ++_last_id;
-    }
+    //! The ids of deleted objects are reused first.
+    uint16_t GenerateObjectID();
 
     //! \brief Returns the number of objects stored by the supervisor, regardless of what layer they exist on
     uint32_t GetNumberObjects() const {
-        return _all_objects.size();
+        return _number_objects;
     }
 
     /** \brief Retrieves a pointer to an object on this map
@@ -1061,13 +1127,57 @@ public:
     **/
     VirtualSprite* GetSprite(uint32_t object_id);
 
-    //! \brief Wrapper to add an object in the all objects vector.
-    //! This should only be called by the MapObject constructor.
-    void RegisterObject(MapObject* object);
+    /** \brief Resolves an object handle in constant time
+    *** \return A pointer to the map object, or nullptr if the handle is null or if its object was deleted
+    **/
+    MapObject* GetObject(const MapObjectHandle& handle);
 
-    //! \brief Delete an object from memory.
+    /** \brief Resolves a sprite handle in constant time
+    *** \return A pointer to the sprite, or nullptr if the handle is null, stale, or not referring to a sprite
+    **/
+    VirtualSprite* GetSprite(const MapObjectHandle& handle);
+
+    //! \brief Tells whether the handle still refers to an existing object.
+    bool IsValidHandle(const MapObjectHandle& handle) const;
+
+    /** \brief Wrapper to add an object in the object slots and in its draw layer.
+    *** This should only be called by the MapObject constructor.
+    *** \return The generation of the object slot, used to create the object handles.
+    **/
+    uint16_t RegisterObject(MapObject* object);
+
+    //! \brief Delete an object from memory, invalidating its handles.
+    //! The object is removed from its draw layer in constant time.
     void DeleteObject(MapObject* object);
 
+    /** \brief Detaches an object from the update, draw and collision structures without deleting it
+    *** The object keeps its id and handles, so that it can be spawned again later on
+    *** in constant time, with its animations and state preserved.
+    *** Objects despawned while updating the objects are removed from their draw layer
+    *** once the update is done. Objects without draw layer, such as lights, halos,
+    *** save points and sound objects, can't be despawned.
+    **/
+    void DespawnObject(MapObject* object);
+
+    //! \brief Attaches a despawned object back to its draw layer.
+    //! \note The object will be drawn in the right order once the objects are sorted again.
+    void SpawnObject(MapObject* object);
+
+    //! \brief Tells whether the object is attached to the update, draw and collision structures.
+    bool IsObjectSpawned(const MapObject* object) const;
+
+    /** \brief Despawns an object and keeps it in a pool for later reuse
+    *** \param pool_name The pool name, usually describing the kind of object such as "villager"
+    *** \param object The object to release, which must not be used anymore by the caller.
+    **/
+    void ReleaseToPool(const std::string& pool_name, MapObject* object);
+
+    /** \brief Takes back an object previously released to a pool
+    *** \return The object, still despawned, or nullptr if the pool is empty.
+    *** The caller is expected to set the object position and state before spawning it.
+    **/
+    MapObject* AcquireFromPool(const std::string& pool_name);
+
     //! \brief Add sound objects (Done within the sound object constructor)
     void AddAmbientSound(SoundObject* object);
 
@@ -1255,6 +1365,33 @@ public:
     void RestartSoundObjects();
 
 private:
+    //! \brief An entry of the object table.
+    struct ObjectSlot {
+        ObjectSlot() :
+            object(nullptr),
+            generation(0),
+            layer_index(0),
+            spawned(false),
+            despawn_pending(false)
+        {}
+
+        //! \brief The object using the slot, or nullptr when the slot is free.
+        MapObject* object;
+
+        //! \brief Incremented whenever the slot object is deleted, invalidating its handles.
+        uint16_t generation;
+
+        //! \brief The index of the object in its draw layer container, when spawned.
+        uint32_t layer_index;
+
+        //! \brief Whether the object is in its draw layer container.
+        bool spawned;
+
+        //! \brief Whether the object was despawned during the update,
+        //! and is still to be removed from its draw layer container.
+        bool despawn_pending;
+    };
+
     //! \brief Returns the nearest save point. Used by FindNearestObject.
     private_map::MapObject *_FindNearestSavePoint(const VirtualSprite *sprite);
 
@@ -1264,12 +1401,30 @@ private:
     //! \brief Updates the ambient sounds volume according to the camera distance.
     void _UpdateAmbientSounds();
 
+    //! \brief Returns the map area around the camera where every object is updated.
+    MapRectangle _GetUpdateArea() const;
+
     //! \brief Debug: Draws the map zones in orange
     void _DrawMapZones();
 
     //! \brief Returns the MapObject vector corresponding to the draw layer.
     std::vector<MapObject*>& _GetObjectsFromDrawLayer(MapObjectDrawLayer layer);
 
+    //! \brief Returns the draw layer container the object is stored in, or nullptr for objects without layer.
+    std::vector<MapObject*>* _GetLayerContainer(MapObjectDrawLayer layer);
+
+    //! \brief Stores the index of each object of the draw layer container in its slot.
+    void _UpdateLayerIndexes(const std::vector<MapObject*>& layer_objects);
+
+    //! \brief Returns the slot of a registered object, or nullptr if the object isn't registered.
+    ObjectSlot* _GetObjectSlot(const MapObject* object);
+
+    //! \brief Removes the object of the slot from its draw layer container in constant time.
+    void _RemoveFromLayer(ObjectSlot& slot);
+
+    //! \brief Removes the objects despawned during the update from their draw layer containers.
+    void _RemovePendingDespawns();
+
     /** \brief The number of rows and columns in the collision grid
     *** The number of collision grid rows and columns is always equal to twice
     *** that of the number of rows and columns of tiles (stored in the TileManager).
@@ -1279,6 +1434,9 @@ private:
     //! \brief Holds the most recently generated object ID number
     uint16_t _last_id;
 
+    //! \brief The number of objects currently registered
+    uint32_t _number_objects;
+
     /** \brief The party member object is used to keep in memory the active member
     *** seen on map. This is later useful in "dungeon" maps for instance, where
     *** the party member in front of the battle formation is the one shown on map.
@@ -1294,12 +1452,25 @@ private:
     **/
     std::vector<std::vector<uint32_t> > _collision_grid;
 
-    /** \brief A map containing pointers to all of the sprites on a map.
-    *** This map does not include a pointer to the _virtual_focus object. The
-    *** sprite's unique identifier integer is used as the vector key.
+    /** \brief The object table, containing pointers to all of the objects on a map.
+    *** The object unique identifier integer is used as the vector key.
     *** MapObjects should only be deleted here.
     **/
-    std::vector<MapObject *> _all_objects;
+    std::vector<ObjectSlot> _object_slots;
+
+    //! \brief The ids of the free slots, reused by the next created objects.
+    std::vector<uint16_t> _free_object_ids;
+
+    //! \brief The pools of despawned objects waiting for reuse, by pool name.
+    //! Handles are kept so that objects deleted in the meantime are skipped.
+    std::map<std::string, std::vector<MapObjectHandle> > _object_pools;
+
+    //! \brief Tells whether the draw layer containers are being iterated over by Update().
+    bool _is_updating;
+
+    //! \brief The ids of the objects despawned during the update.
+    //! They are removed from their draw layer containers once the update is done.
+    std::vector<uint32_t> _pending_despawn_ids;
 
     /** \brief A container for all of the map objects located on the ground layer, and being flat.
     *** See this layer as a pre ground object layer
@@ -97,6 +97,8 @@ VirtualSprite::VirtualSprite(MapObjectDrawLayer layer) :
     _saved_moving(false)
 {
     _object_type = VIRTUAL_TYPE;
+    // Idle sprites far from the camera can wait, see IsUpdateForced().
+    _update_policy = UPDATE_PAUSE_WHEN_CULLED;
 }
 
 VirtualSprite::~VirtualSprite()
@@ -621,6 +623,8 @@ MapSprite::MapSprite(MapObjectDrawLayer layer) :
     _face_portrait(0),
     _has_running_animations(false),
     _current_anim_direction(ANIM_SOUTH),
+    _animations_loaded(false),
+    _animation_load_distance(SPRITE_ANIMATION_LOAD_DISTANCE),
     _current_custom_animation(0),
     _next_dialogue(-1),
     _has_available_dialogue(false),
@@ -801,40 +805,126 @@ void MapSprite::ClearAnimations()
     _custom_animation_time = 0;
     _infinite_custom_animation = false;
     _custom_animations.clear();
+
+    _standing_animations_filename.clear();
+    _walking_animations_filename.clear();
+    _running_animations_filename.clear();
+    _custom_animations_filenames.clear();
+    _animations_loaded = false;
 }
 
 bool MapSprite::LoadStandingAnimations(const std::string &filename)
 {
-    return _LoadAnimations(_standing_animations, filename);
+    if(!vt_utils::DoesFileExist(filename)) {
+        PRINT_WARNING << "The animation file doesn't exist: " << filename << std::endl;
+        return false;
+    }
+
+    // Reload the frames when another file gets registered.
+    if(_standing_animations_filename != filename)
+        _standing_animations.clear();
+    _standing_animations_filename = filename;
+    _animations_loaded = false;
+    return true;
 }
 
 bool MapSprite::LoadWalkingAnimations(const std::string &filename)
 {
-    return _LoadAnimations(_walking_animations, filename);
+    if(!vt_utils::DoesFileExist(filename)) {
+        PRINT_WARNING << "The animation file doesn't exist: " << filename << std::endl;
+        return false;
+    }
+
+    // Reload the frames when another file gets registered.
+    if(_walking_animations_filename != filename)
+        _walking_animations.clear();
+    _walking_animations_filename = filename;
+    _animations_loaded = false;
+    return true;
 }
 
 bool MapSprite::LoadRunningAnimations(const std::string &filename)
 {
-    _has_running_animations = _LoadAnimations(_running_animations, filename);
+    if(!vt_utils::DoesFileExist(filename)) {
+        PRINT_WARNING << "The animation file doesn't exist: " << filename << std::endl;
+        return false;
+    }
 
-    return _has_running_animations;
+    // The sprite state logic needs to know about running animations before they're loaded.
+    if(_running_animations_filename != filename)
+        _running_animations.clear();
+    _running_animations_filename = filename;
+    _has_running_animations = true;
+    _animations_loaded = false;
+    return true;
 }
 
 bool MapSprite::LoadCustomAnimation(const std::string &animation_name, const std::string &filename)
 {
-    if(_custom_animations.find(animation_name) != _custom_animations.end()) {
+    if(_custom_animations_filenames.find(animation_name) != _custom_animations_filenames.end()) {
         PRINT_WARNING << "The animation " << animation_name << " is already existing." << std::endl;
         return false;
     }
 
-    AnimatedImage animation;
-    if(animation.LoadFromAnimationScript(filename)) {
+    if(!vt_utils::DoesFileExist(filename)) {
+        PRINT_WARNING << "The animation file doesn't exist: " << filename << std::endl;
+        return false;
+    }
+
+    _custom_animations_filenames.insert(std::make_pair(animation_name, filename));
+    _animations_loaded = false;
+    return true;
+}
+
+void MapSprite::LoadAnimations()
+{
+    if(_animations_loaded)
+        return;
+    _animations_loaded = true;
+
+    // Only load the 4-direction animations registered since the last loading.
+    // Sprites without animation file only get empty animations.
+    if(_standing_animations_filename.empty())
+        _standing_animations.resize(NUM_ANIM_DIRECTIONS);
+    else if(_standing_animations.empty())
+        _LoadAnimations(_standing_animations, _standing_animations_filename);
+    if(_walking_animations_filename.empty())
+        _walking_animations.resize(NUM_ANIM_DIRECTIONS);
+    else if(_walking_animations.empty())
+        _LoadAnimations(_walking_animations, _walking_animations_filename);
+    if(_has_running_animations && _running_animations.empty())
+        _has_running_animations = _LoadAnimations(_running_animations, _running_animations_filename);
+
+    std::map<std::string, std::string>::const_iterator it = _custom_animations_filenames.begin();
+    for(; it != _custom_animations_filenames.end(); ++it) {
+        if(_custom_animations.find(it->first) != _custom_animations.end())
+            continue;
+
+        AnimatedImage animation;
+        if(!animation.LoadFromAnimationScript(it->second))
+            continue;
+
         MapMode::ScaleToMapZoomRatio(animation);
-        _custom_animations.insert(std::make_pair(animation_name, animation));
-        return true;
+        _custom_animations.insert(std::make_pair(it->first, animation));
     }
 
-    return false;
+    if(_grayscale)
+        SetGrayscale(true);
+}
+
+void MapSprite::_CheckAnimationsLoadDistance()
+{
+    if(_animations_loaded || !_visible)
+        return;
+
+    MapRectangle load_area = MapMode::CurrentInstance()->GetMapFrame().screen_edges;
+    load_area.left -= _animation_load_distance;
+    load_area.right += _animation_load_distance;
+    load_area.top -= _animation_load_distance;
+    load_area.bottom += _animation_load_distance;
+
+    if(MapRectangle::CheckIntersection(GetGridImageRectangle(), load_area))
+        LoadAnimations();
 }
 
 void MapSprite::SetCustomAnimation(const std::string &animation_name, int32_t time)
@@ -845,6 +935,9 @@ void MapSprite::SetCustomAnimation(const std::string &animation_name, int32_t ti
         return;
     }
 
+    // The custom animation is needed right away.
+    LoadAnimations();
+
     // Same if the key isn't found
     std::map<std::string, AnimatedImage>::iterator it = _custom_animations.find(animation_name);
     if(it == _custom_animations.end()) {
@@ -967,6 +1060,11 @@ void MapSprite::Update()
     // This call will update the sprite's position and perform collision detection
     VirtualSprite::Update();
 
+    // Don't animate anything until the sprite animations are loaded.
+    _CheckAnimationsLoadDistance();
+    if(!_animations_loaded)
+        return;
+
     // if it's a custom animation, just display that and ignore everything else
     if(_custom_animation_on && _current_custom_animation) {
         // Check whether the custom animation can be freed
@@ -1079,6 +1177,9 @@ void MapSprite::Draw()
     if(!MapObject::ShouldDraw())
         return;
 
+    // The sprite just became visible.
+    LoadAnimations();
+
     if(_custom_animation_on && _current_custom_animation)
         _current_custom_animation->Draw();
     else
@@ -1253,6 +1354,8 @@ EnemySprite::EnemySprite() :
     _use_path(false)
 {
     _object_type = ENEMY_TYPE;
+    // Enemies handle their own distance checks and respawn timers.
+    _update_policy = UPDATE_ALWAYS;
     _moving = false;
     Reset();
 }
@@ -1315,8 +1418,27 @@ const std::vector<BattleEnemyInfo>& EnemySprite::RetrieveRandomParty() const
     return _enemy_parties[rand() % _enemy_parties.size()];
 }
 
+void EnemySprite::ChangeStateDead()
+{
+    Reset();
+    if(_zone) {
+        _zone->EnemyDead();
+        // Dead zone enemies are kept aside until respawning, so they don't cost anything meanwhile.
+        MapMode::CurrentInstance()->GetObjectSupervisor()->DespawnObject(this);
+    }
+}
+
+void EnemySprite::ChangeStateSpawning()
+{
+    MapMode::CurrentInstance()->GetObjectSupervisor()->SpawnObject(this);
+    _updatable = true;
+    _state = SPAWNING;
+    _collision_mask = NO_COLLISION;
+}
+
 void EnemySprite::ChangeStateHostile()
 {
+    MapMode::CurrentInstance()->GetObjectSupervisor()->SpawnObject(this);
     _updatable = true;
     _state = HOSTILE;
     _collision_mask = WALL_COLLISION | CHARACTER_COLLISION;
@@ -1485,6 +1607,8 @@ void EnemySprite::Draw()
     if (!MapObject::ShouldDraw() || _state == DEAD)
         return;
 
+    LoadAnimations();
+
     _animation->at(_current_anim_direction).Draw(_color);
 
     // Draw collision rectangle if the debug view is on.
@@ -69,6 +69,11 @@ public:
     {
     }
 
+    //! \brief Moving, emoting or event-controlled sprites are always updated.
+    virtual bool IsUpdateForced() const override {
+        return _moving || _control_event || _emote_animation;
+    }
+
     /** \note This method takes into account the current direction when setting the new direction
     *** in the case of diagonal movement. For example, if the sprite is currently facing north
     *** and this function indicates that the sprite should move northwest, it will face north
@@ -256,31 +261,51 @@ public:
 
     // ---------- Public methods
 
-    /** \brief Loads the standing animations of the sprite for the four directions.
+    /** \brief Registers the standing animations of the sprite for the four directions.
     *** \param filename The name of the script animation file holding the standing animations
-    *** \return False if there was a problem loading the sprites.
+    *** \return False if the animation file doesn't exist.
+    *** \note The animation frames themselves are only loaded once the sprite gets near the camera.
+    *** \see LoadAnimations()
     **/
     bool LoadStandingAnimations(const std::string &filename);
 
-    /** \brief Loads the walking animations of the sprite for the four directions.
+    /** \brief Registers the walking animations of the sprite for the four directions.
     *** \param filename The name of the script animation file holding the walking animations
-    *** \return False if there was a problem loading the sprites.
+    *** \return False if the animation file doesn't exist.
     **/
     bool LoadWalkingAnimations(const std::string &filename);
 
-    /** \brief Loads the running animations of the sprite for the four directions.
+    /** \brief Registers the running animations of the sprite for the four directions.
     *** \param filename The name of the image file holding the walking animation
-    *** \return False if there was a problem loading the sprites.
+    *** \return False if the animation file doesn't exist.
     **/
     bool LoadRunningAnimations(const std::string &filename);
 
-    /** \brief Loads the script containing the one-sided custom animation of the sprite.
+    /** \brief Registers the script containing the one-sided custom animation of the sprite.
     *** \param animation_name The animation name of the custom animation.
     *** \param filename The name of the image file holding the given custom animation (one direction only)
-    *** \return False if there was a problem loading the animation.
+    *** \return False if the animation name is already used or if the file doesn't exist.
     **/
     bool LoadCustomAnimation(const std::string &animation_name, const std::string& filename);
 
+    /** \brief Actually loads the frames of every registered animation, if not done yet.
+    *** This is automatically called when the sprite comes within the animation load distance
+    *** of the screen or becomes visible, but can be called to force the loading beforehand.
+    **/
+    void LoadAnimations();
+
+    //! \brief Tells whether the registered animations frames have been loaded.
+    bool AreAnimationsLoaded() const {
+        return _animations_loaded;
+    }
+
+    /** \brief Sets the distance, in grid units, from the screen edges at which the sprite animations
+    *** will be loaded. Defaults to SPRITE_ANIMATION_LOAD_DISTANCE.
+    **/
+    void SetAnimationLoadDistance(float distance) {
+        _animation_load_distance = distance;
+    }
+
     //! \brief Clear out all the sprite animation. Useful in case of reloading.
     void ClearAnimations();
 
@@ -289,6 +314,12 @@ public:
     //! \brief Updates the sprite's position and state.
     virtual void Update();
 
+    //! \brief Sprites playing a timed custom animation are also always updated, so that it ends on time.
+    virtual bool IsUpdateForced() const override {
+        return VirtualSprite::IsUpdateForced()
+               || (_custom_animation_on && !_infinite_custom_animation && _custom_animation_time > 0);
+    }
+
     //! \brief Draws the sprite frame in the appropriate position on the screen, if it is visible.
     virtual void Draw();
 
@@ -471,6 +502,22 @@ protected:
     //! \brief A map containing all the custom animations, indexed by their name.
     std::map<std::string, vt_video::AnimatedImage> _custom_animations;
 
+    /** \name Registered animation files
+    *** The animation script filenames, kept until the animations are actually loaded.
+    **/
+    //@{
+    std::string _standing_animations_filename;
+    std::string _walking_animations_filename;
+    std::string _running_animations_filename;
+    std::map<std::string, std::string> _custom_animations_filenames;
+    //@}
+
+    //! \brief Tells whether the registered animations have been loaded.
+    bool _animations_loaded;
+
+    //! \brief The distance, in grid units, from the screen edges at which the animations get loaded.
+    float _animation_load_distance;
+
     //! \brief The currently used custom animation.
     vt_video::AnimatedImage *_current_custom_animation;
 
@@ -509,6 +556,14 @@ protected:
 
     //! \brief Draws debug information, used for pathfinding mostly.
     void _DrawDebugInfo();
+
+    //! \brief Loads the animations when the visible sprite is close enough to the screen.
+    void _CheckAnimationsLoadDistance();
+
+    //! \brief The animation load distance doesn't depend on the update area.
+    virtual void _UpdateEvenWhenCulled() override {
+        _CheckAnimationsLoadDistance();
+    }
 }; // class MapSprite : public VirtualSprite
 
 //! \brief Data used to load an place enemies on battle grounds
@@ -690,16 +745,10 @@ public:
         _script_files.push_back(script_file);
     }
 
-    void ChangeStateDead() {
-        Reset();
-        if(_zone) _zone->EnemyDead();
-    }
+    //! \brief Kills the enemy. Enemies of a zone are despawned until the zone spawns them again.
+    void ChangeStateDead();
 
-    void ChangeStateSpawning() {
-        _updatable = true;
-        _state = SPAWNING;
-        _collision_mask = NO_COLLISION;
-    }
+    void ChangeStateSpawning();
 
     void ChangeStateHostile();
 
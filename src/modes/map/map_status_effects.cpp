@@ -228,8 +228,9 @@ CharacterIndication::CharacterIndication(vt_global::GlobalCharacter* character,
         _portrait.SetHeightKeepRatio(65.0f);
 }
 
-void CharacterIndication::Update()
+bool CharacterIndication::Update()
 {
+    float previous_alpha = _image_alpha;
     uint32_t elapsed_time = vt_system::SystemManager->GetUpdateTime();
     // Apply fading
     if (_fade_out) {
@@ -251,28 +252,30 @@ void CharacterIndication::Update()
     if (_display_time <= 0) {
         _display_time = 0;
         FadeOut();
-        return;
+    }
+    else {
+        // Update display time otherwise
+        _display_time -= (int32_t)elapsed_time;
     }
 
-    // Update display time otherwise
-    _display_time -= (int32_t)elapsed_time;
+    return !vt_utils::IsFloatEqual(previous_alpha, _image_alpha);
 }
 
-void CharacterIndication::Draw() {
+void CharacterIndication::AddToBatch(vt_video::ImageBatch& batch) const
+{
     if (_image_alpha <= 0.0f)
         return;
 
-    vt_video::VideoManager->SetDrawFlags(vt_video::VIDEO_X_RIGHT, vt_video::VIDEO_Y_BOTTOM, vt_video::VIDEO_BLEND, 0);
-    vt_video::VideoManager->Move(_x_position , _y_position);
-
-    _portrait.Draw(vt_video::Color(1.0f, 1.0f, 1.0f, _image_alpha));
+    vt_video::VideoManager->SetDrawFlags(vt_video::VIDEO_X_RIGHT, vt_video::VIDEO_Y_BOTTOM, 0);
+    batch.AddImage(_portrait, _x_position, _y_position, vt_video::Color(1.0f, 1.0f, 1.0f, _image_alpha));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 // MapStatusEffectsSupervisor class
 ////////////////////////////////////////////////////////////////////////////////
 
-MapStatusEffectsSupervisor::MapStatusEffectsSupervisor()
+MapStatusEffectsSupervisor::MapStatusEffectsSupervisor() :
+    _portraits_batch_outdated(true)
 {
     LoadStatusEffects();
 }
@@ -288,6 +291,7 @@ void MapStatusEffectsSupervisor::LoadStatusEffects()
     _active_status_effects.clear();
     _equipment_status_effects.clear();
     _characters_portraits.clear();
+    _portraits_batch_outdated = true;
 
     std::vector<GlobalCharacter*>* characters = GlobalManager->GetOrderedCharacters();
     if (!characters)
@@ -500,15 +504,23 @@ void MapStatusEffectsSupervisor::UpdateEffects()
 void MapStatusEffectsSupervisor::UpdatePortraits()
 {
     // Update portrait indicators
-    for (uint32_t i = 0; i < _characters_portraits.size(); ++i)
-        _characters_portraits[i].Update();
+    for (uint32_t i = 0; i < _characters_portraits.size(); ++i) {
+        if (_characters_portraits[i].Update())
+            _portraits_batch_outdated = true;
+    }
 }
 
 void MapStatusEffectsSupervisor::Draw()
 {
     // Draw character portraits shown when effects changes are triggered.
-    for (uint32_t i = 0; i < _characters_portraits.size(); ++i)
-        _characters_portraits[i].Draw();
+    // The batch is only rebuilt while some of them are fading.
+    if (_portraits_batch_outdated || _portraits_batch.IsOutdated()) {
+        _portraits_batch.Clear();
+        for (uint32_t i = 0; i < _characters_portraits.size(); ++i)
+            _characters_portraits[i].AddToBatch(_portraits_batch);
+        _portraits_batch_outdated = false;
+    }
+    _portraits_batch.Draw();
 }
 
 bool MapStatusEffectsSupervisor::ChangeActiveStatusEffect(GlobalCharacter* character,
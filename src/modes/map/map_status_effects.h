@@ -23,6 +23,8 @@
 
 #include "common/global/global_effects.h"
 
+#include "engine/video/image_batch.h"
+
 namespace vt_global {
 class GlobalCharacter;
 }
@@ -232,9 +234,12 @@ public:
         _fade_out = true;
     }
 
-    void Update();
+    //! \brief Updates the portrait fading.
+    //! \return Whether the portrait appearance changed.
+    bool Update();
 
-    void Draw();
+    //! \brief Adds the portrait to the given batch, if visible.
+    void AddToBatch(vt_video::ImageBatch& batch) const;
 
     vt_global::GlobalCharacter* GetCharacter()
     { return _global_character; }
@@ -337,6 +342,12 @@ private:
     //! to visually link on what character a status effect change happens.
     std::vector<CharacterIndication> _characters_portraits;
 
+    //! \brief The visible character portraits, drawn at once.
+    vt_video::ImageBatch _portraits_batch;
+
+    //! \brief Tells whether the portraits batch must be rebuilt before being drawn.
+    bool _portraits_batch_outdated;
+
     /** \brief Creates a new status effect and applies it to the actor
     *** \param status The type of the status to create
     *** \param intensity The intensity level that the effect should be initialized at
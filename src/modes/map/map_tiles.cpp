@@ -22,6 +22,8 @@
 
 #include "engine/video/video.h"
 
+#include "utils/utils_strings.h"
+
 using namespace vt_utils;
 using namespace vt_script;
 using namespace vt_video;
@@ -44,7 +46,11 @@ static LAYER_TYPE StringToLayerType(const std::string& type)
 
 TileSupervisor::TileSupervisor() :
     _num_tile_on_x_axis(0),
-    _num_tile_on_y_axis(0)
+    _num_tile_on_y_axis(0),
+    _chunk_width(0),
+    _chunk_height(0),
+    _num_chunks_x(0),
+    _num_chunks_y(0)
 {
 }
 
@@ -56,6 +62,7 @@ TileSupervisor::~TileSupervisor()
         delete(_tile_images[i]);
 
     _tile_grid.clear();
+    _chunks.clear();
     _tile_images.clear();
     _animated_tile_images.clear();
 }
@@ -65,6 +72,10 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
     // Load the map dimensions and do some basic sanity checks
     _num_tile_on_y_axis = map_file.ReadInt("num_tile_rows");
     _num_tile_on_x_axis = map_file.ReadInt("num_tile_cols");
+    if(_num_tile_on_x_axis == 0 || _num_tile_on_y_axis == 0) {
+        PRINT_ERROR << "Invalid map dimensions in file: " << map_file.GetFilename() << std::endl;
+        return false;
+    }
 
     // Load all of the tileset images that are used by this map
 
@@ -118,8 +129,28 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
 
     // Clears out the tiles grid
     _tile_grid.clear();
-
-    std::vector<int32_t> table_x_indeces; // Used to temporarily store a row of table indeces
+    _chunk_directory.clear();
+
+    // Huge maps can split their layers in chunk files, loaded when the camera gets near.
+    // In that case, the 'layers' table only gives the layer types.
+    if(map_file.DoesTableExist("tile_chunks")) {
+        map_file.OpenTable("tile_chunks");
+        uint32_t chunk_size = map_file.ReadUInt("size");
+        _chunk_directory = map_file.ReadString("directory");
+        map_file.CloseTable(); // tile_chunks
+
+        // The chunk dimensions are stored on 16 bits.
+        if(chunk_size == 0 || chunk_size > UINT16_MAX || _chunk_directory.empty()) {
+            PRINT_ERROR << "Invalid 'tile_chunks' table in the map file: " << map_file.GetFilename() << std::endl;
+            return false;
+        }
+        _CreateChunks(chunk_size, chunk_size);
+    }
+    else {
+        // The whole map is then a single chunk.
+        _CreateChunks(_num_tile_on_x_axis, _num_tile_on_y_axis);
+    }
+    const bool streamed = !_chunk_directory.empty();
 
     map_file.OpenTable("layers");
 
@@ -147,41 +178,23 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
 
         _tile_grid[layer_id].layer_type = layer_type;
 
-        // Add the new tile rows (y axis)
-        _tile_grid[layer_id].tiles.resize(_num_tile_on_y_axis);
-
-        // Read the tile data
-        for(uint32_t y = 0; y < _num_tile_on_y_axis; ++y) {
-            table_x_indeces.clear();
-
-            // Check to make sure tables are of the proper size
-            if(!map_file.DoesTableExist(y)) {
-                PRINT_ERROR << "the layers[" << layer_id << "] table size was not equal to the number of tile rows specified by the map, "
-                            " first missing row: " << y << std::endl;
-                return false;
-            }
-
-            map_file.ReadIntVector(y, table_x_indeces);
-
-            // Check the number of columns
-            if(table_x_indeces.size() != _num_tile_on_x_axis) {
-                PRINT_ERROR << "the layers[" << layer_id << "][" << y << "] table size was not equal to the number of tile columns specified by the map, "
-                            "should have " << _num_tile_on_x_axis << " values." << std::endl;
-                return false;
-            }
-
-            // Prepare the columns (x axis)
-            _tile_grid[layer_id].tiles[y].resize(_num_tile_on_x_axis);
+        // Read the tile data, unless it is streamed from the chunk files.
+        if(!streamed && !_ReadChunkLayer(map_file, layer_id, _chunks[0], tileset_filenames.size() * TILES_PER_TILESET))
+            return false;
 
-            for(uint32_t x = 0; x < _num_tile_on_x_axis; ++x) {
-                _tile_grid[layer_id].tiles[y][x] = table_x_indeces[x];
-            }
-        }
         map_file.CloseTable(); // layers[layer_id]
     }
 
     map_file.CloseTable(); // layers
 
+    // Every layer needs tiles, even the invalid ones.
+    if(!streamed) {
+        _chunks[0].tiles.resize(_tile_grid.size());
+        for(uint32_t layer_id = 0; layer_id < _tile_grid.size(); ++layer_id)
+            _chunks[0].tiles[layer_id].resize(_chunks[0].width * _chunks[0].height, -1);
+        _chunks[0].loaded = true;
+    }
+
     // Determine which tiles in each tileset are referenced in this map
 
     // Used to determine whether each tile is used by the map or not. An entry of -1 indicates that particular tile is not used
@@ -189,13 +202,17 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
     // Set size to be equal to the total number of tiles and initialize all entries to -1 (unreferenced)
     tile_references.assign(tileset_filenames.size() * TILES_PER_TILESET, -1);
 
-    // For each layer
-    for(uint32_t layer_id = 0; layer_id < layers_number; ++layer_id) {
-        // For each tile id
-        for(uint32_t y = 0; y < _num_tile_on_y_axis; ++y) {
-            for(uint32_t x = 0; x < _num_tile_on_x_axis; ++x) {
-                if(_tile_grid[layer_id].tiles[y][x] >= 0)
-                    tile_references[_tile_grid[layer_id].tiles[y][x] ] = 0;
+    if(streamed) {
+        // The chunks aren't known yet, so every tile can be referenced and keeps its tileset index.
+        tile_references.assign(tileset_filenames.size() * TILES_PER_TILESET, 0);
+    }
+    else {
+        // For each layer and tile id
+        std::vector<std::vector<int16_t> >& layers = _chunks[0].tiles;
+        for(uint32_t layer_id = 0; layer_id < layers.size(); ++layer_id) {
+            for(uint32_t i = 0; i < layers[layer_id].size(); ++i) {
+                if(layers[layer_id][i] >= 0)
+                    tile_references[layers[layer_id][i]] = 0;
             }
         }
     }
@@ -217,15 +234,15 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
     }
 
     // Now, go back and re-assign all tile layer indeces with the translated indeces
-    // For each layer
-    for(uint32_t layer_id = 0; layer_id < layers_number; ++layer_id) {
-        // For each tile id
-        for(uint32_t y = 0; y < _num_tile_on_y_axis; ++y) {
-            for(uint32_t x = 0; x < _num_tile_on_x_axis; ++x) {
-                if(_tile_grid[layer_id].tiles[y][x] >= 0)
-                    _tile_grid[layer_id].tiles[y][x] = tile_references[_tile_grid[layer_id].tiles[y][x] ];
+    if(!streamed) {
+        std::vector<std::vector<int16_t> >& layers = _chunks[0].tiles;
+        for(uint32_t layer_id = 0; layer_id < layers.size(); ++layer_id) {
+            for(uint32_t i = 0; i < layers[layer_id].size(); ++i) {
+                if(layers[layer_id][i] >= 0)
+                    layers[layer_id][i] = tile_references[layers[layer_id][i]];
             }
         }
+        _BuildChunkSpans(_chunks[0]);
     }
 
     // Parse all of the tileset definition files and create any animated tile images that will be used
@@ -273,6 +290,7 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
                 for(uint32_t k = 0; k < animation_info.size(); k += 2) {
                     new_animation->AddFrame(tileset_images[i][animation_info[k]], animation_info[k + 1]);
                 }
+                new_animation->SetAnimationClock(&_animation_clock);
                 tile_animations.insert(std::make_pair(first_frame_index, new_animation));
             }
             tileset_script.CloseTable();
@@ -316,20 +334,217 @@ bool TileSupervisor::Load(ReadScriptDescriptor &map_file)
 
 void TileSupervisor::Update()
 {
-    for(uint32_t i = 0; i < _animated_tile_images.size(); i++) {
-        _animated_tile_images[i]->Update();
+    // The animated tiles compute their current frame from the clock when drawn.
+    _animation_clock.Update();
+
+    if(!_chunk_directory.empty())
+        _UpdateChunks();
+}
+
+void TileSupervisor::_CreateChunks(uint16_t chunk_width, uint16_t chunk_height)
+{
+    _chunk_width = chunk_width;
+    _chunk_height = chunk_height;
+    _num_chunks_x = (_num_tile_on_x_axis + chunk_width - 1) / chunk_width;
+    _num_chunks_y = (_num_tile_on_y_axis + chunk_height - 1) / chunk_height;
+
+    _chunks.clear();
+    _chunks.resize(_num_chunks_x * _num_chunks_y);
+    for(uint32_t chunk_y = 0; chunk_y < _num_chunks_y; ++chunk_y) {
+        for(uint32_t chunk_x = 0; chunk_x < _num_chunks_x; ++chunk_x) {
+            TileChunk& chunk = _chunks[chunk_y * _num_chunks_x + chunk_x];
+            chunk.x = chunk_x * chunk_width;
+            chunk.y = chunk_y * chunk_height;
+            chunk.width = std::min<uint32_t>(chunk_width, _num_tile_on_x_axis - chunk.x);
+            chunk.height = std::min<uint32_t>(chunk_height, _num_tile_on_y_axis - chunk.y);
+        }
+    }
+}
+
+bool TileSupervisor::_ReadChunkLayer(ReadScriptDescriptor& script, uint32_t layer_id, TileChunk& chunk,
+                                     uint32_t num_tiles)
+{
+    if(chunk.tiles.size() <= layer_id)
+        chunk.tiles.resize(layer_id + 1);
+
+    std::vector<int16_t>& tiles = chunk.tiles[layer_id];
+    tiles.clear();
+    tiles.reserve(chunk.width * chunk.height);
+
+    std::vector<int32_t> table_x_indeces; // Used to temporarily store a row of table indeces
+    for(uint32_t y = 0; y < chunk.height; ++y) {
+        table_x_indeces.clear();
+
+        // Check to make sure tables are of the proper size
+        if(!script.DoesTableExist(y)) {
+            PRINT_ERROR << "the layers[" << layer_id << "] table size was not equal to the number of tile rows expected, "
+                        " first missing row: " << y << " in file: " << script.GetFilename() << std::endl;
+            return false;
+        }
+
+        script.ReadIntVector(y, table_x_indeces);
+
+        // Check the number of columns
+        if(table_x_indeces.size() != chunk.width) {
+            PRINT_ERROR << "the layers[" << layer_id << "][" << y << "] table size was not equal to the number of tile columns expected, "
+                        "should have " << chunk.width << " values in file: " << script.GetFilename() << std::endl;
+            return false;
+        }
+
+        // Stale or hand-edited files could otherwise make the tiles be drawn from out of range images.
+        for(uint32_t x = 0; x < table_x_indeces.size(); ++x) {
+            int32_t tile_id = table_x_indeces[x];
+            if(tile_id < -1 || tile_id >= static_cast<int32_t>(num_tiles)) {
+                PRINT_WARNING << "Ignoring the invalid tile id " << tile_id << " at layers[" << layer_id << "][" << y
+                              << "][" << x << "] in file: " << script.GetFilename() << std::endl;
+                tile_id = -1;
+            }
+            tiles.push_back(static_cast<int16_t>(tile_id));
+        }
+    }
+    return true;
+}
+
+void TileSupervisor::_LoadChunkFile(TileChunk& chunk)
+{
+    // Whatever happens, the chunk has got tiles for every layer afterwards, so it isn't reloaded on failure.
+    chunk.loaded = true;
+
+    const std::string filename = _chunk_directory + NumberToString(chunk.x / _chunk_width) + "_"
+                                 + NumberToString(chunk.y / _chunk_height) + ".lua";
+    ReadScriptDescriptor chunk_file;
+    if(!chunk_file.OpenFile(filename) || !chunk_file.OpenTable("layers")) {
+        PRINT_WARNING << "Couldn't load the tile chunk file: " << filename << std::endl;
+    }
+    else {
+        for(uint32_t layer_id = 0; layer_id < _tile_grid.size(); ++layer_id) {
+            if(!chunk_file.OpenTable(layer_id))
+                continue;
+            if(!_ReadChunkLayer(chunk_file, layer_id, chunk, _tile_images.size()))
+                chunk.tiles[layer_id].clear();
+            chunk_file.CloseTable(); // layers[layer_id]
+        }
+        chunk_file.CloseTable(); // layers
+    }
+    chunk_file.CloseFile();
+
+    chunk.tiles.resize(_tile_grid.size());
+    for(uint32_t layer_id = 0; layer_id < _tile_grid.size(); ++layer_id) {
+        if(chunk.tiles[layer_id].empty())
+            chunk.tiles[layer_id].resize(chunk.width * chunk.height, -1);
+    }
+    _BuildChunkSpans(chunk);
+}
+
+void TileSupervisor::_BuildChunkSpans(TileChunk& chunk)
+{
+    chunk.spans.clear();
+    chunk.row_spans.clear();
+    chunk.spans.resize(chunk.tiles.size());
+    chunk.row_spans.resize(chunk.tiles.size());
+
+    for(uint32_t layer_id = 0; layer_id < chunk.tiles.size(); ++layer_id) {
+        std::vector<int16_t>& tiles = chunk.tiles[layer_id];
+        if(tiles.empty())
+            continue;
+
+        std::vector<TileSpan>& spans = chunk.spans[layer_id];
+        std::vector<uint32_t>& row_spans = chunk.row_spans[layer_id];
+        row_spans.reserve(chunk.height + 1);
+        for(uint32_t y = 0; y < chunk.height; ++y) {
+            row_spans.push_back(spans.size());
+
+            const int16_t* row = &tiles[y * chunk.width];
+            uint32_t x = 0;
+            while(x < chunk.width) {
+                // Skip the empty cells
+                while(x < chunk.width && row[x] < 0)
+                    ++x;
+                if(x == chunk.width)
+                    break;
+
+                uint32_t start = x;
+                while(x < chunk.width && row[x] >= 0)
+                    ++x;
+                spans.push_back(TileSpan(start, x));
+            }
+        }
+        row_spans.push_back(spans.size());
+
+        // The layer has got nothing to draw in this chunk.
+        if(spans.empty()) {
+            tiles.clear();
+            tiles.shrink_to_fit();
+            row_spans.clear();
+        }
+    }
+}
+
+void TileSupervisor::_UpdateChunks(bool load_all_resident)
+{
+    const MapFrame& frame = MapMode::CurrentInstance()->GetMapFrame();
+
+    // The visible chunks range
+    const int32_t first_x = std::max<int32_t>(frame.tile_x_start, 0) / _chunk_width;
+    const int32_t first_y = std::max<int32_t>(frame.tile_y_start, 0) / _chunk_height;
+    const int32_t last_x = std::min<int32_t>(frame.tile_x_start + frame.num_draw_x_axis, _num_tile_on_x_axis - 1) / _chunk_width;
+    const int32_t last_y = std::min<int32_t>(frame.tile_y_start + frame.num_draw_y_axis, _num_tile_on_y_axis - 1) / _chunk_height;
+
+    // The nearest non-visible chunk to load during this update, if any.
+    TileChunk* chunk_to_load = nullptr;
+    int32_t chunk_to_load_distance = TILE_CHUNK_RESIDENT_RADIUS + 1;
+
+    for(int32_t chunk_y = 0; chunk_y < _num_chunks_y; ++chunk_y) {
+        for(int32_t chunk_x = 0; chunk_x < _num_chunks_x; ++chunk_x) {
+            TileChunk& chunk = _chunks[chunk_y * _num_chunks_x + chunk_x];
+
+            // The distance in chunks to the visible ones, 0 when visible.
+            int32_t distance_x = std::max(std::max(first_x - chunk_x, chunk_x - last_x), 0);
+            int32_t distance_y = std::max(std::max(first_y - chunk_y, chunk_y - last_y), 0);
+            int32_t distance = std::max(distance_x, distance_y);
+
+            if(chunk.loaded) {
+                // Free the chunks far enough not to be reloaded right away.
+                if(distance > static_cast<int32_t>(TILE_CHUNK_RESIDENT_RADIUS) + 1) {
+                    chunk.Clear();
+                    chunk.loaded = false;
+                }
+            }
+            // Visible chunks are needed right now.
+            else if(distance == 0 || (load_all_resident && distance <= static_cast<int32_t>(TILE_CHUNK_RESIDENT_RADIUS))) {
+                _LoadChunkFile(chunk);
+            }
+            else if(distance < chunk_to_load_distance) {
+                chunk_to_load = &chunk;
+                chunk_to_load_distance = distance;
+            }
+        }
     }
+
+    // The other resident chunks are loaded one per update to avoid frame spikes.
+    if(chunk_to_load)
+        _LoadChunkFile(*chunk_to_load);
 }
 
 void TileSupervisor::DrawLayers(const MapFrame *frame, const LAYER_TYPE &layer_type)
 {
+    // The visible tiles range, clamped to the map.
+    const int32_t x_start = std::max<int32_t>(frame->tile_x_start, 0);
+    const int32_t y_start = std::max<int32_t>(frame->tile_y_start, 0);
+    const int32_t x_end = std::min<int32_t>(frame->tile_x_start + frame->num_draw_x_axis, _num_tile_on_x_axis);
+    const int32_t y_end = std::min<int32_t>(frame->tile_y_start + frame->num_draw_y_axis, _num_tile_on_y_axis);
+    if(x_start >= x_end || y_start >= y_end)
+        return;
+
+    // The visible chunks range
+    const int32_t first_chunk_x = x_start / _chunk_width;
+    const int32_t first_chunk_y = y_start / _chunk_height;
+    const int32_t last_chunk_x = (x_end - 1) / _chunk_width;
+    const int32_t last_chunk_y = (y_end - 1) / _chunk_height;
+
     // We'll use the top-left positions to render the tiles.
     VideoManager->SetDrawFlags(VIDEO_BLEND, VIDEO_X_LEFT, VIDEO_Y_TOP, 0);
 
-    // Map frame ends
-    uint32_t y_end = static_cast<uint32_t>(frame->tile_y_start + frame->num_draw_y_axis);
-    uint32_t x_end = static_cast<uint32_t>(frame->tile_x_start + frame->num_draw_x_axis);
-
     uint32_t layer_number = _tile_grid.size();
     for(uint32_t layer_id = 0; layer_id < layer_number; ++layer_id) {
 
@@ -337,27 +552,68 @@ void TileSupervisor::DrawLayers(const MapFrame *frame, const LAYER_TYPE &layer_t
         if(layer.layer_type != layer_type)
             continue;
 
-        // We substract 0.5 horizontally and 1.0 vertically here
-        // because the video engine will display the map tiles using their
-        // top left coordinates to avoid a position computation flaw when specifying the tile
-        // coordinates from the bottom center point, as the engine does for everything else.
-        VideoManager->Move(GRID_LENGTH * (frame->tile_x_offset - 1.0f), GRID_LENGTH * (frame->tile_y_offset - 2.0f));
-        for(uint32_t y = static_cast<uint32_t>(frame->tile_y_start); y < y_end; ++y) {
-            for(uint32_t x = static_cast<uint32_t>(frame->tile_x_start); x < x_end; ++x) {
-                // Draw a tile image if it exists at this location
-                if(layer.tiles[y][x] >= 0)
-                    _tile_images[ layer.tiles[y][x] ]->Draw();
+        for(int32_t chunk_y = first_chunk_y; chunk_y <= last_chunk_y; ++chunk_y) {
+            for(int32_t chunk_x = first_chunk_x; chunk_x <= last_chunk_x; ++chunk_x) {
+                const TileChunk& chunk = _chunks[chunk_y * _num_chunks_x + chunk_x];
+                // Skip the chunks where the layer is empty as a whole.
+                if(!chunk.loaded || layer_id >= chunk.spans.size() || chunk.spans[layer_id].empty())
+                    continue;
 
-                VideoManager->MoveRelative(TILE_LENGTH, 0.0f);
-            } // x
-            VideoManager->MoveRelative(-static_cast<float>(frame->num_draw_x_axis) * TILE_LENGTH, TILE_LENGTH);
-        } // y
+                _DrawChunkLayer(chunk, layer_id, frame, x_start, y_start, x_end, y_end);
+            }
+        }
     } // layer_id
 
     // Restore the previous draw flags.
     VideoManager->SetDrawFlags(VIDEO_BLEND, VIDEO_X_CENTER, VIDEO_Y_BOTTOM, 0);
 }
 
+void TileSupervisor::_DrawChunkLayer(const TileChunk& chunk, uint32_t layer_id, const MapFrame* frame,
+                                     int32_t x_start, int32_t y_start, int32_t x_end, int32_t y_end)
+{
+    const std::vector<int16_t>& tiles = chunk.tiles[layer_id];
+    const std::vector<TileSpan>& spans = chunk.spans[layer_id];
+    const std::vector<uint32_t>& row_spans = chunk.row_spans[layer_id];
+
+    // The visible rows and columns, relative to the chunk.
+    const int32_t first_row = std::max<int32_t>(y_start - chunk.y, 0);
+    const int32_t end_row = std::min<int32_t>(y_end - chunk.y, chunk.height);
+    const int32_t first_column = std::max<int32_t>(x_start - chunk.x, 0);
+    const int32_t end_column = std::min<int32_t>(x_end - chunk.x, chunk.width);
+
+    // We substract 0.5 horizontally and 1.0 vertically here
+    // because the video engine will display the map tiles using their
+    // top left coordinates to avoid a position computation flaw when specifying the tile
+    // coordinates from the bottom center point, as the engine does for everything else.
+    const float chunk_x_position = GRID_LENGTH * (frame->tile_x_offset - 1.0f)
+                                   + static_cast<float>(chunk.x - frame->tile_x_start) * TILE_LENGTH;
+    const float chunk_y_position = GRID_LENGTH * (frame->tile_y_offset - 2.0f)
+                                   + static_cast<float>(chunk.y - frame->tile_y_start) * TILE_LENGTH;
+
+    for(int32_t y = first_row; y < end_row; ++y) {
+        const int16_t* row = &tiles[y * chunk.width];
+
+        // Only the runs of tiles are drawn, the empty cells are skipped.
+        for(uint32_t i = row_spans[y]; i < row_spans[y + 1]; ++i) {
+            const TileSpan& span = spans[i];
+            if(span.start >= end_column)
+                break;
+
+            const int32_t start = std::max<int32_t>(span.start, first_column);
+            const int32_t end = std::min<int32_t>(span.end, end_column);
+            if(start >= end)
+                continue;
+
+            VideoManager->Move(chunk_x_position + static_cast<float>(start) * TILE_LENGTH,
+                               chunk_y_position + static_cast<float>(y) * TILE_LENGTH);
+            for(int32_t x = start; x < end; ++x) {
+                _tile_images[row[x]]->Draw();
+                VideoManager->MoveRelative(TILE_LENGTH, 0.0f);
+            }
+        }
+    }
+}
+
 } // namespace private_map
 
 } // namespace vt_map
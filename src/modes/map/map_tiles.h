@@ -24,11 +24,7 @@
 #include "modes/map/map_utils.h"
 
 #include "engine/script/script_read.h"
-
-namespace vt_video {
-class ImageDescriptor;
-class AnimatedImage;
-}
+#include "engine/video/image.h"
 
 namespace vt_map
 {
@@ -45,18 +41,85 @@ enum LAYER_TYPE {
     INVALID_LAYER = 2
 };
 
+//! \brief The number of chunks around the visible ones kept in memory on streamed maps.
+const uint32_t TILE_CHUNK_RESIDENT_RADIUS = 1;
+
 class Layer
 {
 public:
     LAYER_TYPE layer_type;
-    // Represents the tile indeces: i.e: tiles[y][x] = tile_id at (x,y)
-    std::vector< std::vector<int16_t> > tiles;
 
     Layer():
         layer_type(GROUND_LAYER)
     {}
 };
 
+//! \brief A run of consecutive non-empty tiles on a chunk row, in chunk relative columns.
+class TileSpan
+{
+public:
+    TileSpan(uint16_t first, uint16_t last):
+        start(first),
+        end(last)
+    {}
+
+    //! \brief The first tile column of the run, and the column right after its last tile.
+    uint16_t start, end;
+};
+
+/** ****************************************************************************
+*** \brief A rectangular part of the map tile layers, loaded and freed as a whole.
+***
+*** Maps declaring a 'tile_chunks' table have their tile layers split in chunk
+*** files which are only loaded when near the camera. Other maps are made of
+*** a single chunk covering the whole map, loaded with the map file.
+***
+*** Along with the tiles, the chunk keeps the runs of non-empty tiles of each row,
+*** so that drawing skips the empty cells, which are frequent on upper layers.
+*** The tiles of a layer without any tile in the chunk aren't kept at all.
+*** ***************************************************************************/
+class TileChunk
+{
+public:
+    TileChunk():
+        x(0),
+        y(0),
+        width(0),
+        height(0),
+        loaded(false)
+    {}
+
+    //! \brief The chunk top-left tile coordinates on the map.
+    uint16_t x, y;
+
+    //! \brief The chunk dimensions in tiles. Chunks on the map edges may be smaller.
+    uint16_t width, height;
+
+    //! \brief Tells whether the tiles are in memory.
+    bool loaded;
+
+    /** \brief The tile indeces for each layer: tiles[layer_id][y * width + x] = tile_id at (x,y), relative to the chunk.
+    *** The vector of a layer is empty when the layer has no tile in the chunk.
+    **/
+    std::vector<std::vector<int16_t> > tiles;
+
+    //! \brief The runs of non-empty tiles of each layer, row after row.
+    std::vector<std::vector<TileSpan> > spans;
+
+    /** \brief The index of the first run of each row in spans: The runs of row y of a layer
+    *** are spans[layer_id][row_spans[layer_id][y]] up to spans[layer_id][row_spans[layer_id][y + 1]], excluded.
+    *** Empty for layers without tiles in the chunk.
+    **/
+    std::vector<std::vector<uint32_t> > row_spans;
+
+    //! \brief Frees the tiles and their runs.
+    void Clear() {
+        tiles.clear();
+        spans.clear();
+        row_spans.clear();
+    }
+};
+
 /** ****************************************************************************
 *** \brief A helper class to MapMode responsible for all tile data and operations
 ***
@@ -66,6 +129,17 @@ public:
 ***
 *** Maps have a minimum size of 24 rows and 32 columns of tiles. Theoretically
 *** there is no upper limit on size.
+***
+*** Huge maps can keep memory use bounded by splitting their tile layers in chunk
+*** files, declared in the map data file as follows:
+*** tile_chunks = { size = 32, directory = "data/story/my_map/chunks/" }
+*** Each chunk file, named "<chunk_x>_<chunk_y>.lua", then contains a 'layers' table
+*** with the rows of each layer for that chunk, and the 'layers' table of the map
+*** file only gives the layer types. The chunks are loaded when coming near the camera
+*** and freed once far from it.
+***
+*** \note The collision grid, the map objects and the tile images of every tileset
+*** are still loaded for the whole map.
 *** ***************************************************************************/
 class TileSupervisor
 {
@@ -82,7 +156,7 @@ public:
     **/
     bool Load(vt_script::ReadScriptDescriptor &map_file);
 
-    //! \brief Updates all animated tile images
+    //! \brief Updates the clock shared by all animated tile images and streams the tile chunks, if any.
     void Update();
 
     /** \brief Draws the various tile layers to the screen
@@ -113,6 +187,18 @@ private:
     //! \brief The map tile layers
     std::vector<Layer> _tile_grid;
 
+    //! \brief The dimensions of a tile chunk. Equal to the map dimensions when it isn't streamed.
+    uint16_t _chunk_width, _chunk_height;
+
+    //! \brief The number of chunks on each axis.
+    uint16_t _num_chunks_x, _num_chunks_y;
+
+    //! \brief The directory containing the chunk files, or an empty string when the map isn't streamed.
+    std::string _chunk_directory;
+
+    //! \brief The tile chunks, row by row: _chunks[chunk_y * _num_chunks_x + chunk_x]
+    std::vector<TileChunk> _chunks;
+
     //! \brief Contains the image objects for all map tiles, both still and animated.
     std::vector<vt_video::ImageDescriptor *> _tile_images;
 
@@ -121,6 +207,37 @@ private:
     *** _tile_images vector, which contains both still and animated images.
     **/
     std::vector<vt_video::AnimatedImage *> _animated_tile_images;
+
+    /** \brief The clock all tile animations are subscribed to.
+    *** Updating it is enough to animate every tile, whatever their number.
+    **/
+    vt_video::AnimationClock _animation_clock;
+
+    //! \brief Splits the map into chunks of the given dimensions.
+    void _CreateChunks(uint16_t chunk_width, uint16_t chunk_height);
+
+    /** \brief Reads the rows of one layer of the chunk from the currently opened layer table.
+    *** \param num_tiles The number of tiles the ids may refer to. Ids out of range are replaced by -1.
+    *** \return false if the table doesn't match the chunk dimensions.
+    **/
+    bool _ReadChunkLayer(vt_script::ReadScriptDescriptor& script, uint32_t layer_id, TileChunk& chunk,
+                         uint32_t num_tiles);
+
+    //! \brief Loads a chunk from its chunk file. The chunk is marked as loaded even on failure.
+    void _LoadChunkFile(TileChunk& chunk);
+
+    //! \brief Computes the runs of non-empty tiles of a loaded chunk and frees its empty layers.
+    void _BuildChunkSpans(TileChunk& chunk);
+
+    //! \brief Draws the visible runs of tiles of one layer of the chunk.
+    void _DrawChunkLayer(const TileChunk& chunk, uint32_t layer_id, const MapFrame* frame,
+                         int32_t x_start, int32_t y_start, int32_t x_end, int32_t y_end);
+
+    /** \brief Loads the chunks near the camera and frees the ones far from it.
+    *** \param load_all_resident Whether every chunk near the camera is loaded right away,
+    *** instead of one per update for the non-visible ones. Used when loading the map.
+    **/
+    void _UpdateChunks(bool load_all_resident = false);
 }; // class TileSupervisor
 
 } // namespace private_map
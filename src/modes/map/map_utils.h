@@ -51,6 +51,19 @@ const float SCREEN_GRID_Y_LENGTH = 48.0f / MAP_ZOOM_RATIO;
 const float HALF_SCREEN_GRID_X_LENGTH = SCREEN_GRID_X_LENGTH / 2.0f;
 const float HALF_SCREEN_GRID_Y_LENGTH = SCREEN_GRID_Y_LENGTH / 2.0f;
 
+// The distance, in grid units, from the screen edges beyond which objects may stop being updated.
+const float UPDATE_CULLING_MARGIN_X = HALF_SCREEN_GRID_X_LENGTH;
+const float UPDATE_CULLING_MARGIN_Y = HALF_SCREEN_GRID_Y_LENGTH;
+
+//! \brief The maximum number of halos, and of lights, drawn at once when the video quality is reduced.
+//! They are scaled down further by the video engine quality factor.
+//! Lights draw several flares each, hence their smaller budget.
+const uint32_t MAX_REDUCED_QUALITY_HALOS = 24;
+const uint32_t MAX_REDUCED_QUALITY_LIGHTS = 8;
+
+// The default distance, in grid units, from the screen edges at which map sprites animations are loaded.
+const float SPRITE_ANIMATION_LOAD_DISTANCE = HALF_SCREEN_GRID_X_LENGTH;
+
 const uint16_t TILES_ON_X_AXIS = static_cast<uint16_t>(SCREEN_GRID_X_LENGTH / 2.0f); // Number of tile columns that fit on the screen
 const uint16_t TILES_ON_Y_AXIS = static_cast<uint16_t>(SCREEN_GRID_Y_LENGTH / 2.0f); // Number of tile rows that fit on the screen
 const uint16_t HALF_TILES_ON_X_AXIS = TILES_ON_X_AXIS / 2;
@@ -253,6 +266,47 @@ public:
 }; // class MapRectangle
 
 
+/** ****************************************************************************
+*** \brief A weak reference to a map object
+***
+*** A handle is made of the object id, which is the object slot in the object
+*** supervisor, and of the slot generation at the time the handle was taken.
+*** The slot generation changes whenever its object is deleted, so handles to
+*** deleted objects resolve to nullptr, even once their id was given to a new object.
+*** Handles are cheap to copy and can be kept for the whole map lifetime.
+*** ***************************************************************************/
+class MapObjectHandle
+{
+public:
+    MapObjectHandle() :
+        id(0), generation(0)
+    {}
+
+    MapObjectHandle(uint16_t object_id, uint16_t object_generation) :
+        id(object_id), generation(object_generation)
+    {}
+
+    //! \brief Tells whether the handle doesn't refer to any object. A set handle may still be stale.
+    bool IsNull() const {
+        return id == 0;
+    }
+
+    bool operator==(const MapObjectHandle &other) const {
+        return id == other.id && generation == other.generation;
+    }
+
+    bool operator!=(const MapObjectHandle &other) const {
+        return !(*this == other);
+    }
+
+    //! \brief The object id, 0 for null handles.
+    uint16_t id;
+
+    //! \brief The generation of the object slot when the handle was taken.
+    uint16_t generation;
+}; // class MapObjectHandle
+
+
 /** ****************************************************************************
 *** \brief Retains information about how the next map frame should be drawn.
 ***
@@ -292,9 +292,11 @@ void EnemyZone::AddEnemy(EnemySprite* enemy, uint8_t enemy_number)
         return;
     }
 
-    // Prepare the first enemy
+    // Prepare the first enemy. It stays despawned until the zone spawns it.
     enemy->SetZone(this);
     _enemies.push_back(enemy);
+    if(enemy->IsDead())
+        MapMode::CurrentInstance()->GetObjectSupervisor()->DespawnObject(enemy);
 
     // Create any additional copies of the enemy and add them as well
     for (uint8_t i = 1; i < enemy_number; ++i) {
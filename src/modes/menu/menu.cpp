@@ -789,8 +789,7 @@ MenuMode::MenuMode() :
     _object(nullptr),
     _character(nullptr),
     _equip_view_type(EQUIP_VIEW_NONE),
-    _is_weapon(false),
-    _spirit_number(0)
+    _equipment_preview(nullptr)
 
 {
     _current_instance = this;
@@ -953,14 +952,6 @@ MenuMode::MenuMode() :
     _phys_header.SetStyle(TextStyle("text18"));
     _mag_header.SetStyle(TextStyle("text18"));
 
-    _phys_stat.SetStyle(TextStyle("text18"));
-    _mag_stat.SetStyle(TextStyle("text18"));
-
-    _object_name.SetStyle(TextStyle("text20"));
-
-    _phys_stat_diff.SetStyle(TextStyle("text18"));
-    _mag_stat_diff.SetStyle(TextStyle("text18"));
-
     _equip_skills_header.SetStyle(TextStyle("title20"));
     _equip_skills_header.SetText(UTranslate("Skills obtained:"));
 }
@@ -1059,80 +1050,75 @@ void MenuMode::UpdateEquipmentInfo(GlobalCharacter *character,
     _object = object;
     _character = character;
     _equip_view_type = view_type;
+    _equipment_preview = nullptr;
 
-    // Clear the corresponding texts when there is no corresponding data
-    if (!_object) {
-        _object_name.Clear();
-        _status_icons.clear();
-        _spirit_number = 0;
-        _equip_skills.clear();
-        _equip_skill_icons.clear();
-
-        _phys_header.Clear();
-        _mag_header.Clear();
-        _phys_stat.Clear();
-        _mag_stat.Clear();
-    }
-
-    if (view_type == EQUIP_VIEW_NONE)
+    // If there is no object, we can return here.
+    if (!_object || view_type == EQUIP_VIEW_NONE)
         return;
 
-    // Don't show any diff when there no selected character,
-    // or not showing equip/unequip diffs.
-    if (!_character || view_type == EQUIP_VIEW_CHAR) {
-        _phys_stat_diff.Clear();
-        _mag_stat_diff.Clear();
+    // Find out which equipment the character has in the object slot
+    // to know whether a previously prepared preview is still valid.
+    std::shared_ptr<GlobalObject> base_equipment = nullptr;
+    if (_character) {
+        if (_object->GetObjectType() == GLOBAL_OBJECT_WEAPON)
+            base_equipment = _character->GetWeaponEquipped();
+        else if (GetEquipmentPositionFromObjectType(_object->GetObjectType()) != GLOBAL_POSITION_INVALID)
+            base_equipment = _character->GetArmorEquipped(GetEquipmentPositionFromObjectType(_object->GetObjectType()));
+    }
+    uint32_t base_equipment_id = base_equipment ? base_equipment->GetID() : 0;
+
+    EquipmentPreviewKey key(_character, std::make_pair(_object->GetID(), view_type));
+    EquipmentPreview& preview = _equipment_previews[key];
+    if (!preview.prepared || preview.base_equipment_id != base_equipment_id) {
+        preview = EquipmentPreview();
+        preview.base_equipment_id = base_equipment_id;
+        _PrepareEquipmentPreview(preview);
+        preview.prepared = true;
     }
+    _equipment_preview = &preview;
 
-    // If there is no object, we can return here.
-    if (!_object)
-        return;
+    if (preview.is_weapon) {
+        _phys_header.SetText(UTranslate("ATK:"));
+        _mag_header.SetText(UTranslate("M.ATK:"));
+    }
+    else {
+        _phys_header.SetText(UTranslate("DEF:"));
+        _mag_header.SetText(UTranslate("M.DEF:"));
+    }
+}
 
-    _object_name.SetText(_object->GetName());
+void MenuMode::_PrepareEquipmentPreview(EquipmentPreview& preview)
+{
+    preview.object_name.SetText(_object->GetName(), TextStyle("text20"));
 
     // Loads status effects.
     const std::vector<std::pair<GLOBAL_STATUS, GLOBAL_INTENSITY> >& status_effects = _object->GetStatusEffects();
-    _status_icons.clear();
     for(std::vector<std::pair<GLOBAL_STATUS, GLOBAL_INTENSITY> >::const_iterator it = status_effects.begin();
             it != status_effects.end(); ++it) {
         if(it->second != GLOBAL_INTENSITY_NEUTRAL)
-            _status_icons.push_back(GlobalManager->Media().GetStatusIcon(it->first, it->second));
+            preview.status_icons.push_back(GlobalManager->Media().GetStatusIcon(it->first, it->second));
     }
 
     uint32_t equip_phys_stat = 0;
     uint32_t equip_mag_stat = 0;
+    const std::vector<uint32_t>* equip_skills = nullptr;
 
     switch (_object->GetObjectType()) {
         default: // Should never happen
             return;
         case GLOBAL_OBJECT_WEAPON: {
-            _is_weapon = true;
+            preview.is_weapon = true;
             std::shared_ptr<GlobalWeapon> wpn = nullptr;
             // If character view or unequipping, we take the character current weapon as a base
-            if (view_type == EQUIP_VIEW_CHAR || view_type == EQUIP_VIEW_UNEQUIPPING)
+            if (_equip_view_type == EQUIP_VIEW_CHAR || _equip_view_type == EQUIP_VIEW_UNEQUIPPING)
                 wpn = _character ? _character->GetWeaponEquipped() : nullptr;
             else // We can take the given object as a base
                 wpn = std::dynamic_pointer_cast<GlobalWeapon>(_object);
 
-            _spirit_number = wpn ? wpn->GetSpiritSlots().size() : 0;
+            preview.spirit_number = wpn ? wpn->GetSpiritSlots().size() : 0;
             equip_phys_stat = wpn ? wpn->GetPhysicalAttack() : 0;
             equip_mag_stat = wpn ? wpn->GetMagicalAttack() : 0;
-
-            const std::vector<uint32_t>& equip_skills = wpn->GetEquipmentSkills();
-            _equip_skills.clear();
-            _equip_skill_icons.clear();
-            // Display a max of 5 skills
-            for (uint32_t i = 0; i < equip_skills.size() && i < 5; ++i) {
-                GlobalSkill *skill = new GlobalSkill(equip_skills[i]);
-                if (skill && skill->IsValid()) {
-                    _equip_skills.push_back(vt_video::TextImage(skill->GetName(), TextStyle("text20")));
-                    _equip_skill_icons.push_back(vt_video::StillImage());
-                    vt_video::StillImage& img = _equip_skill_icons.back();
-                    img.Load(skill->GetIconFilename());
-                    img.SetWidthKeepRatio(15.0f);
-                }
-                delete skill;
-            }
+            equip_skills = wpn ? &wpn->GetEquipmentSkills() : nullptr;
             break;
         }
 
@@ -1141,11 +1127,11 @@ void MenuMode::UpdateEquipmentInfo(GlobalCharacter *character,
         case GLOBAL_OBJECT_ARM_ARMOR:
         case GLOBAL_OBJECT_LEG_ARMOR:
         {
-            _is_weapon = false;
+            preview.is_weapon = false;
             std::shared_ptr<GlobalArmor> armor = nullptr;
 
             // If character view or unequipping, we take the character current armor as a base
-            if (view_type == EQUIP_VIEW_CHAR || view_type == EQUIP_VIEW_UNEQUIPPING) {
+            if (_equip_view_type == EQUIP_VIEW_CHAR || _equip_view_type == EQUIP_VIEW_UNEQUIPPING) {
                 uint32_t equip_index = GetEquipmentPositionFromObjectType(_object->GetObjectType());
                 armor = _character ? _character->GetArmorEquipped(equip_index) : nullptr;
             }
@@ -1153,50 +1139,39 @@ void MenuMode::UpdateEquipmentInfo(GlobalCharacter *character,
                 armor = std::dynamic_pointer_cast<GlobalArmor>(_object);
             }
 
-            _spirit_number = armor ? armor->GetSpiritSlots().size() : 0;
+            preview.spirit_number = armor ? armor->GetSpiritSlots().size() : 0;
             equip_phys_stat = armor ? armor->GetPhysicalDefense() : 0;
             equip_mag_stat = armor ? armor->GetMagicalDefense() : 0;
-
-            const std::vector<uint32_t>& equip_skills = armor->GetEquipmentSkills();
-            _equip_skills.clear();
-            _equip_skill_icons.clear();
-            // Display a max of 5 skills
-            for (uint32_t i = 0; i < equip_skills.size() && i < 5; ++i) {
-                GlobalSkill *skill = new GlobalSkill(equip_skills[i]);
-                if (skill && skill->IsValid()) {
-                    _equip_skills.push_back(vt_video::TextImage(skill->GetName(), TextStyle("text20")));
-                    _equip_skill_icons.push_back(vt_video::StillImage());
-                    vt_video::StillImage& img = _equip_skill_icons.back();
-                    img.Load(skill->GetIconFilename());
-                    img.SetWidthKeepRatio(15.0f);
-                }
-                delete skill;
-            }
+            equip_skills = armor ? &armor->GetEquipmentSkills() : nullptr;
             break;
         }
     }
 
-    if (_is_weapon) {
-        _phys_header.SetText(UTranslate("ATK:"));
-        _mag_header.SetText(UTranslate("M.ATK:"));
-    }
-    else {
-        _phys_header.SetText(UTranslate("DEF:"));
-        _mag_header.SetText(UTranslate("M.DEF:"));
+    // Display a max of 5 skills
+    for (uint32_t i = 0; equip_skills && i < equip_skills->size() && i < 5; ++i) {
+        GlobalSkill *skill = new GlobalSkill(equip_skills->at(i));
+        if (skill && skill->IsValid()) {
+            preview.equip_skills.push_back(vt_video::TextImage(skill->GetName(), TextStyle("text20")));
+            preview.equip_skill_icons.push_back(vt_video::StillImage());
+            vt_video::StillImage& img = preview.equip_skill_icons.back();
+            img.Load(skill->GetIconFilename());
+            img.SetWidthKeepRatio(15.0f);
+        }
+        delete skill;
     }
 
-    _phys_stat.SetText(NumberToString(equip_phys_stat));
-    _mag_stat.SetText(NumberToString(equip_mag_stat));
+    preview.phys_stat.SetText(NumberToString(equip_phys_stat), TextStyle("text18"));
+    preview.mag_stat.SetText(NumberToString(equip_mag_stat), TextStyle("text18"));
 
     // We can stop here if there is no valid character, or simply showing
     // the object stats
-    if (!_character || view_type == EQUIP_VIEW_CHAR)
+    if (!_character || _equip_view_type == EQUIP_VIEW_CHAR)
         return;
 
     int32_t phys_stat_diff = 0;
     int32_t mag_stat_diff = 0;
 
-    if (_is_weapon) {
+    if (preview.is_weapon) {
         // Get the character's current attack
         std::shared_ptr<GlobalWeapon> wpn = _character->GetWeaponEquipped();
         uint32_t char_phys_stat = 0;
@@ -1233,27 +1208,21 @@ void MenuMode::UpdateEquipmentInfo(GlobalCharacter *character,
 
     // Compute the overall stats diff with selected equipment
     if (phys_stat_diff > 0) {
-        _phys_stat_diff.SetText("+" + NumberToString(phys_stat_diff));
-        _phys_diff_color.SetColor(Color::green);
+        preview.phys_stat_diff.SetText("+" + NumberToString(phys_stat_diff), TextStyle("text18"));
+        preview.phys_diff_color.SetColor(Color::green);
     }
     else if (phys_stat_diff < 0) {
-        _phys_stat_diff.SetText(NumberToString(phys_stat_diff));
-        _phys_diff_color.SetColor(Color::red);
-    }
-    else {
-        _phys_stat_diff.Clear();
+        preview.phys_stat_diff.SetText(NumberToString(phys_stat_diff), TextStyle("text18"));
+        preview.phys_diff_color.SetColor(Color::red);
     }
 
     if (mag_stat_diff > 0) {
-        _mag_stat_diff.SetText("+" + NumberToString(mag_stat_diff));
-        _mag_diff_color.SetColor(Color::green);
+        preview.mag_stat_diff.SetText("+" + NumberToString(mag_stat_diff), TextStyle("text18"));
+        preview.mag_diff_color.SetColor(Color::green);
     }
     else if (mag_stat_diff < 0) {
-        _mag_stat_diff.SetText(NumberToString(mag_stat_diff));
-        _mag_diff_color.SetColor(Color::red);
-    }
-    else {
-        _mag_stat_diff.Clear();
+        preview.mag_stat_diff.SetText(NumberToString(mag_stat_diff), TextStyle("text18"));
+        preview.mag_diff_color.SetColor(Color::red);
     }
 }
 
@@ -1268,12 +1237,14 @@ void MenuMode::Draw()
 
 void MenuMode::DrawEquipmentInfo()
 {
-    if (!_object)
+    if (!_object || !_equipment_preview)
         return;
 
+    const EquipmentPreview& preview = *_equipment_preview;
+
     VideoManager->SetDrawFlags(VIDEO_X_LEFT, VIDEO_Y_TOP, 0);
     VideoManager->Move(100.0f, 560.0f);
-    _object_name.Draw();
+    preview.object_name.Draw();
 
     VideoManager->MoveRelative(0.0f, 30.0f);
     const StillImage& obj_icon = _object->GetIconImage();
@@ -1290,7 +1261,7 @@ void MenuMode::DrawEquipmentInfo()
 
     // Draw weapon stats
     VideoManager->MoveRelative(70.0f, 0.0f);
-    if (_is_weapon)
+    if (preview.is_weapon)
         _atk_icon->Draw();
     else
         _def_icon->Draw();
@@ -1298,7 +1269,7 @@ void MenuMode::DrawEquipmentInfo()
     _phys_header.Draw();
 
     VideoManager->MoveRelative(-25.0f, 30.0f);
-    if (_is_weapon)
+    if (preview.is_weapon)
         _matk_icon->Draw();
     else
         _mdef_icon->Draw();
@@ -1307,20 +1278,20 @@ void MenuMode::DrawEquipmentInfo()
 
     VideoManager->SetDrawFlags(VIDEO_X_RIGHT, 0);
     VideoManager->MoveRelative(110.0f, -30.0f);
-    _phys_stat.Draw();
+    preview.phys_stat.Draw();
     VideoManager->MoveRelative(0.0f, 30.0f);
-    _mag_stat.Draw();
+    preview.mag_stat.Draw();
 
     // Draw diff with current weapon stat, if any
     VideoManager->MoveRelative(50.0f, -30.0f);
-    _phys_stat_diff.Draw(_phys_diff_color);
+    preview.phys_stat_diff.Draw(preview.phys_diff_color);
     VideoManager->MoveRelative(0.0f, 30.0f);
-    _mag_stat_diff.Draw(_mag_diff_color);
+    preview.mag_stat_diff.Draw(preview.mag_diff_color);
 
     VideoManager->SetDrawFlags(VIDEO_X_LEFT, 0);
     VideoManager->MoveRelative(20.0f, 0.0f);
     float j = 0;
-    for (uint32_t i = 0; i < _spirit_number; ++i) {
+    for (uint32_t i = 0; i < preview.spirit_number; ++i) {
         _spirit_icon->Draw();
         if (i % 2 == 0) {
             VideoManager->MoveRelative(15.0f , 0.0f);
@@ -1334,32 +1305,32 @@ void MenuMode::DrawEquipmentInfo()
     VideoManager->MoveRelative(j, -55.0f);
 
     // Draw status effects icons
-    uint32_t element_size = _status_icons.size() > 9 ? 9 : _status_icons.size();
+    uint32_t element_size = preview.status_icons.size() > 9 ? 9 : preview.status_icons.size();
     VideoManager->MoveRelative((18.0f * element_size), 0.0f);
     for(uint32_t i = 0; i < element_size; ++i) {
-        _status_icons[i]->Draw();
+        preview.status_icons[i]->Draw();
         VideoManager->MoveRelative(-18.0f, 0.0f);
     }
     VideoManager->MoveRelative(0.0f, 20.0f);
-    if (_status_icons.size() > 9) {
-        element_size = _status_icons.size();
+    if (preview.status_icons.size() > 9) {
+        element_size = preview.status_icons.size();
         VideoManager->MoveRelative((18.0f * (element_size - 9)), 0.0f);
         for(uint32_t i = 9; i < element_size; ++i) {
-            _status_icons[i]->Draw();
+            preview.status_icons[i]->Draw();
             VideoManager->MoveRelative(-18.0f, 0.0f);
         }
     }
 
     // Draw possible equipment skills
     VideoManager->MoveRelative(250.0f, -20.0f);
-    element_size = _equip_skills.size();
+    element_size = preview.equip_skills.size();
     if (element_size > 0)
         _equip_skills_header.Draw();
     VideoManager->MoveRelative(10.0f, 20.0f);
     for (uint32_t i = 0; i < element_size; ++i) {
-        _equip_skills[i].Draw();
+        preview.equip_skills[i].Draw();
         VideoManager->MoveRelative(-20.0f, 5.0f);
-        _equip_skill_icons[i].Draw();
+        preview.equip_skill_icons[i].Draw();
         VideoManager->MoveRelative(20.0f, 15.0f);
     }
 }
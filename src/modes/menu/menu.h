@@ -58,6 +58,57 @@ enum EQUIP_VIEW {
     EQUIP_VIEW_UNEQUIPPING = 2
 };
 
+/** ****************************************************************************
+*** \brief The bottom window equipment info prepared for a character, an object and a view type
+***
+*** The stats, the differences against the character equipment and the related
+*** texts are computed and rendered once, and reused as long as the character keeps
+*** the same piece of equipment in the corresponding slot. Browsing the equipment
+*** lists then only swaps prepared data.
+*** ***************************************************************************/
+class EquipmentPreview
+{
+public:
+    EquipmentPreview() :
+        prepared(false),
+        base_equipment_id(0),
+        is_weapon(false),
+        spirit_number(0)
+    {}
+
+    //! \brief Tells whether the data below has already been computed
+    bool prepared;
+
+    //! \brief The id of the equipment the character had in the slot when the preview was computed, or 0.
+    uint32_t base_equipment_id;
+
+    //! \brief The name of the object
+    vt_video::TextImage object_name;
+
+    //! \brief When the object type is equipment, this tells whether it is a weapon.
+    bool is_weapon;
+
+    //! \brief The equipment stats
+    vt_video::TextImage phys_stat;
+    vt_video::TextImage mag_stat;
+
+    //! \brief The overall atk/def diff with current equipment
+    vt_video::TextImage phys_stat_diff;
+    vt_video::TextImage mag_stat_diff;
+    vt_video::Color phys_diff_color;
+    vt_video::Color mag_diff_color;
+
+    //! \brief Icon images representing status effects and intensity properties of the object
+    std::vector<vt_video::StillImage *> status_icons;
+
+    //! \brief The number of spirit the equipment can support.
+    uint32_t spirit_number;
+
+    //! \brief The skills earned when equipping
+    std::vector<vt_video::TextImage> equip_skills;
+    std::vector<vt_video::StillImage> equip_skill_icons;
+}; // class EquipmentPreview
+
 /**
 *** \brief Defines a single menu state, which includes the currently viewing parameters and transition states
 ***
@@ -560,37 +611,27 @@ private:
     //! \brief the current equipment view type
     private_menu::EQUIP_VIEW _equip_view_type;
 
-    //! \brief The name of the selected object
-    vt_video::TextImage _object_name;
+    //! \brief Identifies an equipment preview: The character, the object id and the view type
+    typedef std::pair<vt_global::GlobalCharacter*, std::pair<uint32_t, private_menu::EQUIP_VIEW> > EquipmentPreviewKey;
 
-    //! \brief When the object type is equipment, this tells whether it is a weapon.
-    bool _is_weapon;
+    //! \brief The equipment previews prepared while the menu is open
+    std::map<EquipmentPreviewKey, private_menu::EquipmentPreview> _equipment_previews;
+
+    //! \brief The preview of the selected object, or nullptr when there is nothing to show
+    private_menu::EquipmentPreview* _equipment_preview;
 
     //! \brief The text headers
     vt_video::TextImage _phys_header;
     vt_video::TextImage _mag_header;
 
-    //! \brief The equipment stats
-    vt_video::TextImage _phys_stat;
-    vt_video::TextImage _mag_stat;
-
-    //! \brief The overall atk/def diff with current equipment
-    vt_video::TextImage _phys_stat_diff;
-    vt_video::TextImage _mag_stat_diff;
-    vt_video::Color _phys_diff_color;
-    vt_video::Color _mag_diff_color;
-
-    //! \brief Icon images representing status effects and intensity properties of the selected object
-    std::vector<vt_video::StillImage *> _status_icons;
-
-    //! \brief The number of spirit the equipment can support.
-    uint32_t _spirit_number;
-
-    //! \brief The skills earned when equipping info
+    //! \brief The skills earned when equipping info header
     vt_video::TextImage _equip_skills_header;
-    std::vector<vt_video::TextImage> _equip_skills;
-    std::vector<vt_video::StillImage> _equip_skill_icons;
     //@}
+
+    /** \brief Computes the stats and differences of the selected object and character
+    *** and renders the related texts in the given preview.
+    **/
+    void _PrepareEquipmentPreview(private_menu::EquipmentPreview& preview);
 }; // class MenuMode : public vt_mode_manager::GameMode
 
 } // namespace vt_menu
@@ -944,14 +944,17 @@ void PartyWindow::Update()
 
 void PartyWindow::UpdateStatus()
 {
-    _character_status_numbers.Clear();
-    _average_atk_def_numbers.Clear();
-    _focused_def_numbers.Clear();
-    _focused_mdef_numbers.Clear();
-
     GlobalCharacter *ch =  GlobalManager->GetActiveParty()->GetCharacterAtIndex(_char_select.GetSelection());
-    if (!ch)
+    if (!ch) {
+        _character_status_numbers.Clear();
+        _average_atk_def_numbers.Clear();
+        _focused_def_numbers.Clear();
+        _focused_mdef_numbers.Clear();
         return;
+    }
+
+    // Note: The texts are only re-rendered when they actually changed,
+    // and the icons only reloaded when the equipment changed.
 
     vt_utils::ustring text;
     text = UTranslate("Experience Level: ") + MakeUnicodeString(NumberToString(ch->GetExperienceLevel()))
@@ -982,40 +985,30 @@ void PartyWindow::UpdateStatus()
 
     _average_atk_def_numbers.SetText(text);
 
-    _weapon_icon.Clear();
     std::shared_ptr<GlobalWeapon> weapon = ch->GetWeaponEquipped();
-    if (weapon)
-        _weapon_icon.Load(weapon->GetIconImage().GetFilename());
-    else
-        _weapon_icon.Load("data/inventory/weapons/fist-human.png");
-    _weapon_icon.SetHeightKeepRatio(40);
-
-    std::shared_ptr<GlobalArmor> head_armor = ch->GetHeadArmorEquipped();
-    _focused_def_armor_icons[0].Clear();
-    if (head_armor) {
-        _focused_def_armor_icons[0].Load(head_armor->GetIconImage().GetFilename());
-        _focused_def_armor_icons[0].SetHeightKeepRatio(20);
+    const std::string weapon_icon_filename = weapon ? weapon->GetIconImage().GetFilename()
+                                                    : "data/inventory/weapons/fist-human.png";
+    if (_weapon_icon.GetFilename() != weapon_icon_filename) {
+        _weapon_icon.Clear();
+        _weapon_icon.Load(weapon_icon_filename);
+        _weapon_icon.SetHeightKeepRatio(40);
     }
 
-    _focused_def_armor_icons[1].Clear();
+    std::shared_ptr<GlobalArmor> head_armor = ch->GetHeadArmorEquipped();
     std::shared_ptr<GlobalArmor> torso_armor = ch->GetTorsoArmorEquipped();
-    if (torso_armor) {
-        _focused_def_armor_icons[1].Load(torso_armor->GetIconImage().GetFilename());
-        _focused_def_armor_icons[1].SetHeightKeepRatio(20);
-    }
-
-    _focused_def_armor_icons[2].Clear();
     std::shared_ptr<GlobalArmor> arm_armor = ch->GetArmArmorEquipped();
-    if (arm_armor) {
-        _focused_def_armor_icons[2].Load(arm_armor->GetIconImage().GetFilename());
-        _focused_def_armor_icons[2].SetHeightKeepRatio(20);
-    }
-
-    _focused_def_armor_icons[3].Clear();
     std::shared_ptr<GlobalArmor> leg_armor = ch->GetLegArmorEquipped();
-    if (leg_armor) {
-        _focused_def_armor_icons[3].Load(leg_armor->GetIconImage().GetFilename());
-        _focused_def_armor_icons[3].SetHeightKeepRatio(20);
+    const std::shared_ptr<GlobalArmor> armors[] = { head_armor, torso_armor, arm_armor, leg_armor };
+    for (uint32_t i = 0; i < 4; ++i) {
+        const std::string armor_icon_filename = armors[i] ? armors[i]->GetIconImage().GetFilename() : std::string();
+        if (_focused_def_armor_icons[i].GetFilename() == armor_icon_filename)
+            continue;
+
+        _focused_def_armor_icons[i].Clear();
+        if (armors[i]) {
+            _focused_def_armor_icons[i].Load(armor_icon_filename);
+            _focused_def_armor_icons[i].SetHeightKeepRatio(20);
+        }
     }
 
     text = MakeUnicodeString("\n") // Skip titles
@@ -1797,7 +1790,8 @@ void SkillsWindow::Draw()
 
 EquipWindow::EquipWindow() :
     _active_box(EQUIP_ACTIVE_NONE),
-    _character(nullptr)
+    _character(nullptr),
+    _equipment_lists_outdated(true)
 {
     // Init the labels
     _weapon_label.SetStyle(TextStyle("text20"));
@@ -1823,6 +1817,9 @@ void EquipWindow::Activate(bool new_status, bool equip)
 
     _equip = equip;
 
+    // The inventory and equipment may have changed since the last time.
+    _equipment_lists_outdated = true;
+
     //Activate window and first option box...or deactivate both
     if(new_status) {
         _active_box = EQUIP_ACTIVE_CHAR;
@@ -1914,6 +1911,11 @@ void EquipWindow::Update()
 
     GlobalMedia& media = GlobalManager->Media();
 
+    // Keep track of the browsing state, to only rebuild the lists when it changed.
+    uint32_t previous_active_box = _active_box;
+    GlobalCharacter* previous_character = _character;
+    int32_t previous_equip_selection = _equip_select.GetSelection();
+
     //choose correct menu
     switch(_active_box) {
     case EQUIP_ACTIVE_CHAR:
@@ -1952,6 +1954,11 @@ void EquipWindow::Update()
 
     uint32_t event = active_option->GetEvent();
     active_option->Update();
+
+    // Any confirmation may equip or unequip something.
+    if (event == VIDEO_OPTION_CONFIRM)
+        _equipment_lists_outdated = true;
+
     switch(_active_box) {
     //Choose character
     case EQUIP_ACTIVE_CHAR:
@@ -2105,7 +2112,14 @@ void EquipWindow::Update()
         break;
     } // switch _active_box
 
-    _UpdateEquipList();
+    if (_active_box != previous_active_box || _character != previous_character
+            || _equip_select.GetSelection() != previous_equip_selection)
+        _equipment_lists_outdated = true;
+
+    if (_equipment_lists_outdated) {
+        _UpdateEquipList();
+        _equipment_lists_outdated = false;
+    }
     _UpdateSelectedObject();
 } // void EquipWindow::Update()
 
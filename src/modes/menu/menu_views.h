@@ -562,6 +562,10 @@ private:
     //! \brief The current object the equip window is dealing with.
     std::shared_ptr<vt_global::GlobalObject> _object;
 
+    //! \brief Tells whether the equipment lists must be rebuilt on the next update.
+    //! They only change when browsing to another character, slot or box, or when confirming.
+    bool _equipment_lists_outdated;
+
     //! \brief The different labels
     vt_video::TextImage _weapon_label;
     vt_video::TextImage _head_label;
@@ -92,6 +92,11 @@ void BindModeCode()
             .def("SetRunningEnabled", &MapMode::SetRunningEnabled)
 
             .def("DeleteMapObject", &MapMode::DeleteMapObject)
+            .def("GetMapObject", &MapMode::GetMapObject)
+            .def("DespawnMapObject", &MapMode::DespawnMapObject)
+            .def("SpawnMapObject", &MapMode::SpawnMapObject)
+            .def("ReleaseMapObjectToPool", &MapMode::ReleaseMapObjectToPool)
+            .def("AcquireMapObjectFromPool", &MapMode::AcquireMapObjectFromPool)
 
             .def("SetCamera", (void(MapMode:: *)(private_map::VirtualSprite *))&MapMode::SetCamera)
             .def("SetCamera", (void(MapMode:: *)(private_map::VirtualSprite *, uint32_t))&MapMode::SetCamera)
@@ -190,6 +195,13 @@ void BindModeCode()
             ]
         ];
 
+        luabind::module(vt_script::ScriptManager->GetGlobalState(), "vt_map")
+        [
+            luabind::class_<MapObjectHandle>("MapObjectHandle")
+            .def(luabind::constructor<>())
+            .def("IsNull", &MapObjectHandle::IsNull)
+        ];
+
         luabind::module(vt_script::ScriptManager->GetGlobalState(), "vt_map")
         [
             luabind::class_<MapObject>("MapObject")
@@ -205,6 +217,7 @@ void BindModeCode()
             .def("SetCollisionMask", &MapObject::SetCollisionMask)
             .def("SetDrawOnSecondPass", &MapObject::SetDrawOnSecondPass)
             .def("GetObjectID", &MapObject::GetObjectID)
+            .def("GetHandle", &MapObject::GetHandle)
             .def("GetXPosition", &MapObject::GetXPosition)
             .def("GetYPosition", &MapObject::GetYPosition)
             .def("GetImgScreenHalfWidth", &MapObject::GetImgScreenHalfWidth)
@@ -343,6 +356,8 @@ void BindModeCode()
             .def("LoadWalkingAnimations", &MapSprite::LoadWalkingAnimations)
             .def("LoadRunningAnimations", &MapSprite::LoadRunningAnimations)
             .def("LoadCustomAnimation", &MapSprite::LoadCustomAnimation)
+            .def("LoadAnimations", &MapSprite::LoadAnimations)
+            .def("SetAnimationLoadDistance", &MapSprite::SetAnimationLoadDistance)
             .def("ClearAnimations", &MapSprite::ClearAnimations)
             .def("SetCustomAnimation", &MapSprite::SetCustomAnimation)
             .def("DisableCustomAnimation", &MapSprite::DisableCustomAnimation)
@@ -495,6 +510,8 @@ void BindModeCode()
             .def("HasActiveDelayedEvent", &EventSupervisor::HasActiveDelayedEvent)
             .def("GetEvent", &EventSupervisor::GetEvent)
             .def("DoesEventExist", &EventSupervisor::DoesEventExist)
+            .def("DeclareEvent", &EventSupervisor::DeclareEvent)
+            .def("LoadEventGraph", &EventSupervisor::LoadEventGraph)
         ];
 
         luabind::module(vt_script::ScriptManager->GetGlobalState(), "vt_map")
@@ -55,7 +55,6 @@ PauseMode::PauseMode(bool quit_state, bool pause_audio) :
     GameMode(MODE_MANAGER_PAUSE_MODE),
     _quit_state(quit_state),
     _audio_paused(pause_audio),
-    _music_volume(1.0f),
     _dim_color(0.35f, 0.35f, 0.35f, 1.0f), // A grayish opaque color
     _option_selected(false),
     _options_handler(this)
@@ -70,7 +69,7 @@ PauseMode::PauseMode(bool quit_state, bool pause_audio) :
 
     // Render the paused string in white text
     _paused_text.SetStyle(TextStyle("title28", Color::white, VIDEO_TEXT_SHADOW_BLACK));
-    _paused_text.SetText(UTranslate("Paused"));
+    _paused_text.SetTranslatableText("Paused");
 
     // Initialize the quit options box
     _quit_options.SetPosition(512.0f, 384.0f);
@@ -88,47 +87,28 @@ PauseMode::PauseMode(bool quit_state, bool pause_audio) :
 void PauseMode::_SetupOptions()
 {
     _quit_options.ClearOptions();
-    _quit_options.AddOption(UTranslate("Cancel"));
-    _quit_options.AddOption(UTranslate("Options"));
-    _quit_options.AddOption(UTranslate("Quit to Main Menu"));
-    _quit_options.AddOption(UTranslate("Quit Game"));
+    _quit_options.AddTranslatableOption("Cancel");
+    _quit_options.AddTranslatableOption("Options");
+    _quit_options.AddTranslatableOption("Quit to Main Menu");
+    _quit_options.AddTranslatableOption("Quit Game");
     _quit_options.SetSelection(QUIT_CANCEL);
 }
 
-void PauseMode::ReloadTranslatedTexts()
-{
-    _SetupOptions();
-}
-
 PauseMode::~PauseMode()
 {
     if(_audio_paused)
         AudioManager->ResumeAudio();
-    else {
-        MusicDescriptor *active_music = AudioManager->GetActiveMusic();
-        if (!active_music)
-            return;
-        else
-            active_music->SetVolume(_music_volume);
-    }
+    else
+        AudioManager->UnduckBus(AUDIO_BUS_MUSIC);
 }
 
 void PauseMode::Reset()
 {
-    if (_audio_paused) {
+    // Either pause all the audio, or lower the music while the game is paused.
+    if (_audio_paused)
         AudioManager->PauseAudio();
-    }
-    else {
-        MusicDescriptor *active_music = AudioManager->GetActiveMusic();
-        if (active_music) {
-            _music_volume = active_music->GetVolume();
-            if (active_music->GetVolume() > 0.3f)
-                active_music->SetVolume(0.3f);
-        }
-        else {
-            _music_volume = 0.0f;
-        }
-    }
+    else
+        AudioManager->DuckBus(AUDIO_BUS_MUSIC, 0.3f);
 
     VideoManager->DisableFadeEffect();
 }
@@ -75,8 +75,8 @@ public:
     //! \brief Draws the next frame to be displayed on the screen, bunt unaffected but ambient effects
     void DrawPostEffects();
 
-    //! \brief Reload the different translated texts
-    void ReloadTranslatedTexts();
+    // ReloadTranslatedTexts() isn't needed: The "Paused" text and the quit options
+    // are translatable, and are translated again when next drawn after a language change.
 
 private:
     //! \brief When true, the player is presented with quit options. When false, "Paused" is displayed on the screen
@@ -85,9 +85,6 @@ private:
     //! \brief Set to true if the audio should be resumed when this mode finishes
     bool _audio_paused;
 
-    //! \brief The original music volume. Used to restore it when quitting the pause mode.
-    float _music_volume;
-
     //! \brief A screen capture of the last frame rendered on the screen before PauseMode was invoked
     vt_video::StillImage _screen_capture;
 
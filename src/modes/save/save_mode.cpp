@@ -201,7 +201,7 @@ SaveMode::SaveMode(bool save_mode, uint32_t x_position, uint32_t y_position) :
 
     // Load the first slot data
     if(_file_list.GetSelection() > -1)
-        _PreviewGame(_BuildSaveFilename(_file_list.GetSelection()));
+        _PreviewGame(_file_list.GetSelection());
 }
 
 SaveMode::~SaveMode()
@@ -266,7 +266,7 @@ void SaveMode::Update()
                 GlobalManager->SetSaveStamina(stamina);
 
                 // Attempt to save the game
-                if(GlobalManager->SaveGame(_BuildSaveFilename(id), id, _x_position, _y_position)) {
+                if(GlobalManager->SaveGame(GetSaveFilename(id), id, _x_position, _y_position)) {
                     _current_state = SAVE_MODE_SAVE_COMPLETE;
                     AudioManager->PlaySound("data/sounds/save_successful_nick_bowler_oga.wav");
                     // Remove the autosave in that case.
@@ -283,15 +283,15 @@ void SaveMode::Update()
         case SAVE_MODE_SAVE_COMPLETE:
         case SAVE_MODE_SAVE_FAILED:
             _current_state = SAVE_MODE_SAVING;
-            _PreviewGame(_BuildSaveFilename(_file_list.GetSelection()));
+            _PreviewGame(_file_list.GetSelection());
             break;
         case SAVE_MODE_CONFIRM_AUTOSAVE:
             switch (_load_auto_save_optionbox.GetSelection()) {
             case 0: // Load autosave
-                _LoadGame(_BuildSaveFilename(_file_list.GetSelection(), true));
+                _LoadGame(GetSaveFilename(_file_list.GetSelection(), true));
                 break;
             case 1: // Load save
-                _LoadGame(_BuildSaveFilename(_file_list.GetSelection()));
+                _LoadGame(GetSaveFilename(_file_list.GetSelection()));
                 break;
             case 2: // Cancel
             default:
@@ -306,7 +306,7 @@ void SaveMode::Update()
                     _current_state = SAVE_MODE_CONFIRM_AUTOSAVE;
                 }
                 else {
-                    _LoadGame(_BuildSaveFilename(id));
+                    _LoadGame(GetSaveFilename(id));
                 }
             } else {
                 // Leave right away where there is nothing else
@@ -333,11 +333,11 @@ void SaveMode::Update()
             break;
         case SAVE_MODE_CONFIRM_AUTOSAVE:
             _current_state = SAVE_MODE_LOADING;
-            _PreviewGame(_BuildSaveFilename(_file_list.GetSelection()));
+            _PreviewGame(_file_list.GetSelection());
             break;
         case SAVE_MODE_CONFIRMING_SAVE:
             _current_state = SAVE_MODE_SAVING;
-            _PreviewGame(_BuildSaveFilename(_file_list.GetSelection()));
+            _PreviewGame(_file_list.GetSelection());
             break;
         }
     }
@@ -348,7 +348,7 @@ void SaveMode::Update()
         case SAVE_MODE_LOADING:
             _file_list.InputUp();
             if(_file_list.GetSelection() > -1) {
-                _PreviewGame(_BuildSaveFilename(_file_list.GetSelection()));
+                _PreviewGame(_file_list.GetSelection());
             } else {
                 _ClearSaveData(false);
             }
@@ -369,7 +369,7 @@ void SaveMode::Update()
         case SAVE_MODE_LOADING:
             _file_list.InputDown();
             if(_file_list.GetSelection() > -1) {
-                _PreviewGame(_BuildSaveFilename(_file_list.GetSelection()));
+                _PreviewGame(_file_list.GetSelection());
             }
             else {
                 _ClearSaveData(false);
@@ -502,14 +502,16 @@ void SaveMode::_ClearSaveData(bool selected_file_exists)
 }
 
 
-bool SaveMode::_PreviewGame(const std::string& filename)
+bool SaveMode::_PreviewGame(uint32_t id, bool autosave)
 {
     // Check for the file existence, prevents a useless warning
-    if(!vt_utils::DoesFileExist(filename)) {
+    if(!GetSaveFileInfo(id, autosave).exists) {
         _ClearSaveData(false);
         return false;
     }
 
+    const std::string filename = GetSaveFilename(id, autosave);
+
     ReadScriptDescriptor file;
 
     // Clear out the save data namespace to avoid loading false information
@@ -669,17 +671,17 @@ bool SaveMode::_PreviewGame(const std::string& filename)
 
 bool SaveMode::_IsAutoSaveValid(uint32_t id)
 {
-    std::string autosave_filename = _BuildSaveFilename(id, true);
-    std::string save_filename = _BuildSaveFilename(id, false);
-    if (!vt_utils::DoesFileExist(autosave_filename) || !vt_utils::DoesFileExist(save_filename))
+    const SaveFileInfo& autosave_info = GetSaveFileInfo(id, true);
+    const SaveFileInfo& save_info = GetSaveFileInfo(id, false);
+    if (!autosave_info.exists || !save_info.exists)
         return false;
 
     // Check whether the autosave is strictly more recent than the save.
-    if (vt_utils::GetFileModTime(autosave_filename) <= vt_utils::GetFileModTime(_BuildSaveFilename(id)))
+    if (autosave_info.mod_time <= save_info.mod_time)
         return false;
 
     // And check whether the autosave is valid.
-    if (!_PreviewGame(autosave_filename))
+    if (!_PreviewGame(id, true))
         return false;
 
     return true;
@@ -689,6 +691,7 @@ void SaveMode::_InitSaveSlots()
 {
     // Check all available slots for saves and autosaves.
     bool available_saves = false;
+    RefreshSaveFileCatalog();
 
     // When in load mode, check the saves validity and skip invalid slots
     _file_list.SetSkipDisabled(true);
@@ -703,7 +706,7 @@ void SaveMode::_InitSaveSlots()
             _file_list.AddOptionElementPosition(i, 30);
         }
 
-        if (!_PreviewGame(_BuildSaveFilename(i))) {
+        if (!_PreviewGame(i)) {
             _file_list.EnableOption(i, false);
 
             // If the current selection is disabled, reset it.
@@ -719,21 +722,11 @@ void SaveMode::_InitSaveSlots()
         _current_state = SAVE_MODE_NO_VALID_SAVES;
 }
 
-std::string SaveMode::_BuildSaveFilename(uint32_t id, bool autosave)
-{
-    std::ostringstream file;
-    file << GetUserDataPath() + "saved_game_" << id;
-    if (autosave)
-        file << "_autosave.lua";
-    else
-        file << ".lua";
-    return file.str();
-}
-
 void SaveMode::_DeleteAutoSave(uint32_t id)
 {
-    std::string filename = _BuildSaveFilename(id, true);
+    std::string filename = GetSaveFilename(id, true);
     vt_utils::DeleteFile(filename);
+    InvalidateSaveFileCatalog();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -110,7 +110,9 @@ private:
     bool _LoadGame(const std::string& filename);
 
     //! \brief Loads preview data for the highlighted game
-    bool _PreviewGame(const std::string& filename);
+    //! \param id The save slot id
+    //! \param autosave Whether to preview the slot autosave
+    bool _PreviewGame(uint32_t id, bool autosave = false);
 
     //! \brief Clears out the data saves. Used especially when the data is invalid.
     //! \param selected_file_exists Tells whether the selected file exists.
@@ -122,9 +124,6 @@ private:
     //! \brief Check whether there is a valid autosave file for the given slot.
     bool _IsAutoSaveValid(uint32_t id);
 
-    //! \brief Returns the corresponding save game filename (or autosave).
-    std::string _BuildSaveFilename(uint32_t id, bool autosave = false);
-
     //! \brief Delete a previous autosave.
     //! Used in the case the player loaded a regular autosave, or saved on a save point.
     void _DeleteAutoSave(uint32_t id);
@@ -145,14 +145,12 @@ ShopObjectViewer::ShopObjectViewer() :
     _selected_object(nullptr),
     _object_type(SHOP_OBJECT_INVALID),
     _is_weapon(false),
+    _object_display(nullptr),
     _map_usable(false),
     _battle_usable(false),
-    _target_type_index(0),
-    _spirit_number(0)
+    _target_type_index(0)
 {
     // Initialize all properties of class members that we can
-    _object_name.SetStyle(TextStyle("title24"));
-
     // Position and dimensions for _description_text are set by _SetDescriptionText()
     _description_text.SetTextStyle(TextStyle("text20"));
     _description_text.SetDisplayMode(VIDEO_TEXT_INSTANT);
@@ -199,9 +197,6 @@ ShopObjectViewer::ShopObjectViewer() :
     _mag_header.SetStyle(TextStyle("text18"));
     _mag_header.SetText(UTranslate("M.ATK:"));
 
-    _phys_rating.SetStyle(TextStyle("text18"));
-    _mag_rating.SetStyle(TextStyle("text18"));
-
     _conditions_title.SetStyle(TextStyle("text22"));
     _conditions_title.SetText(UTranslate("Conditions:"));
 
@@ -254,9 +249,6 @@ void ShopObjectViewer::Initialize()
 
     for(uint32_t i = 0; i < number_character; ++i) {
         _character_sprites.push_back(&animations->at(i));
-        _character_equipped.push_back(false);
-        _phys_change_text.push_back(TextImage());
-        _mag_change_text.push_back(TextImage());
     }
 }
 
@@ -299,7 +291,7 @@ void ShopObjectViewer::Draw()
     }
 
     // Object's name and icon are drawn in the same position for all objects
-    _object_name.Draw();
+    _object_display->name.Draw();
     VideoManager->MoveRelative(0.0f, 55.0f);
     std::shared_ptr<GlobalObject> object = _selected_object->GetObject();
     object->GetIconImage().Draw();
@@ -344,6 +336,7 @@ void ShopObjectViewer::SetSelectedObject(ShopObject *object)
 {
     if(object == nullptr) {
         _selected_object = nullptr;
+        _object_display = nullptr;
         return;
     }
 
@@ -354,6 +347,9 @@ void ShopObjectViewer::SetSelectedObject(ShopObject *object)
     _selected_object = object;
     _object_type = _selected_object->DetermineShopObjectType();
 
+    // Reuse the display data prepared the first time this object was selected.
+    _object_display = &_object_displays[_selected_object->GetObject()->GetID()];
+
     // Get a pointer to the global object type of the new object selection
     switch(_object_type) {
     case SHOP_OBJECT_ITEM:
@@ -370,7 +366,10 @@ void ShopObjectViewer::SetSelectedObject(ShopObject *object)
         break;
     }
 
-    _object_name.SetText(_selected_object->GetObject()->GetName());
+    if(!_object_display->prepared) {
+        _object_display->name.SetText(_selected_object->GetObject()->GetName(), TextStyle("title24"));
+        _object_display->prepared = true;
+    }
     _description_text.SetDisplayText(_selected_object->GetObject()->GetDescription());
 
     _SetHintText();
@@ -419,8 +418,8 @@ void ShopObjectViewer::_UpdateTradeConditions()
         // Gets how many items the party has got
         uint32_t owned_number = GlobalManager->HowManyObjectsInInventory(item_id);
 
-        // Create a global object to get info from.
-        std::shared_ptr<GlobalObject> obj = GlobalCreateNewObject(item_id, 1);
+        // Get the shared display object to get info from.
+        std::shared_ptr<GlobalObject> obj = ShopCatalog::GetObject(item_id);
         if (!obj)
             continue;
 
@@ -495,6 +494,32 @@ void ShopObjectViewer::_SetEquipmentData()
         return;
     }
 
+    if(!_object_display->prepared)
+        _PrepareEquipmentData();
+
+    _is_weapon = _object_display->is_weapon;
+    if(_is_weapon) {
+        _phys_header.SetText(UTranslate("ATK:"));
+        _mag_header.SetText(UTranslate("M.ATK:"));
+    } else {
+        _phys_header.SetText(UTranslate("DEF:"));
+        _mag_header.SetText(UTranslate("M.DEF:"));
+    }
+
+    // Toggle grayscale mode appropriately to indicate whether or not each character can equip this
+    const std::vector<bool>& character_usable = _object_display->character_usable;
+    for(uint32_t i = 0; i < character_usable.size() && i < _character_sprites.size(); ++i) {
+        if(_character_sprites[i]->IsGrayscale() == character_usable[i])
+            _character_sprites[i]->SetGrayscale(!character_usable[i]);
+    }
+}
+
+
+
+void ShopObjectViewer::_PrepareEquipmentData()
+{
+    ShopObjectDisplay& display = *_object_display;
+
     // Determine whether the selected object is a weapon or piece of armor
     std::shared_ptr<GlobalWeapon> selected_weapon = nullptr;
     std::shared_ptr<GlobalArmor> selected_armor = nullptr;
@@ -504,11 +529,11 @@ void ShopObjectViewer::_SetEquipmentData()
     if(_selected_object->GetObject()->GetObjectType() == GLOBAL_OBJECT_WEAPON) {
         selected_weapon = std::dynamic_pointer_cast<GlobalWeapon>(_selected_object->GetObject());
         usable_status = selected_weapon->GetUsableBy();
-        _is_weapon = true;
+        display.is_weapon = true;
     } else {
         selected_armor = std::dynamic_pointer_cast<GlobalArmor>(_selected_object->GetObject());
         usable_status = selected_armor->GetUsableBy();
-        _is_weapon = false;
+        display.is_weapon = false;
 
         // Armor on GlobalCharacter objects are stored in 4-element vectors. The different armor type maps to one of these four elements
         switch(selected_armor->GetObjectType()) {
@@ -533,33 +558,29 @@ void ShopObjectViewer::_SetEquipmentData()
     // Determine equipment's rating, socket, elemental effects, and status effects to report
 
     if(selected_weapon) {
-        _phys_header.SetText(UTranslate("ATK:"));
-        _mag_header.SetText(UTranslate("M.ATK:"));
-        _phys_rating.SetText(NumberToString(selected_weapon->GetPhysicalAttack()));
-        _mag_rating.SetText(NumberToString(selected_weapon->GetMagicalAttack()));
-        _spirit_number = selected_weapon->GetSpiritSlots().size();
+        display.phys_rating.SetText(NumberToString(selected_weapon->GetPhysicalAttack()), TextStyle("text18"));
+        display.mag_rating.SetText(NumberToString(selected_weapon->GetMagicalAttack()), TextStyle("text18"));
+        display.spirit_number = selected_weapon->GetSpiritSlots().size();
         _SetStatusIcons(selected_weapon->GetStatusEffects());
     } else if(selected_armor) {
-        _phys_header.SetText(UTranslate("DEF:"));
-        _mag_header.SetText(UTranslate("M.DEF:"));
-        _phys_rating.SetText(NumberToString(selected_armor->GetPhysicalDefense()));
-        _mag_rating.SetText(NumberToString(selected_armor->GetMagicalDefense()));
-        _spirit_number = selected_armor->GetSpiritSlots().size();
+        display.phys_rating.SetText(NumberToString(selected_armor->GetPhysicalDefense()), TextStyle("text18"));
+        display.mag_rating.SetText(NumberToString(selected_armor->GetMagicalDefense()), TextStyle("text18"));
+        display.spirit_number = selected_armor->GetSpiritSlots().size();
         _SetStatusIcons(selected_armor->GetStatusEffects());
     }
 
     // Updates Equipment skills
     const std::vector<uint32_t>& equip_skills = selected_weapon ? selected_weapon->GetEquipmentSkills() :
                                               selected_armor->GetEquipmentSkills();
-    _equip_skills.clear();
-    _equip_skill_icons.clear();
+    display.equip_skills.clear();
+    display.equip_skill_icons.clear();
     // Display a max of 5 skills
     for (uint32_t i = 0; i < equip_skills.size() && i < 5; ++i) {
         GlobalSkill *skill = new GlobalSkill(equip_skills[i]);
         if (skill && skill->IsValid()) {
-            _equip_skills.push_back(vt_video::TextImage(skill->GetName(), TextStyle("text20")));
-            _equip_skill_icons.push_back(vt_video::StillImage());
-            vt_video::StillImage& img = _equip_skill_icons.back();
+            display.equip_skills.push_back(vt_video::TextImage(skill->GetName(), TextStyle("text20")));
+            display.equip_skill_icons.push_back(vt_video::StillImage());
+            vt_video::StillImage& img = display.equip_skill_icons.back();
             img.Load(skill->GetIconFilename());
             img.SetWidthKeepRatio(15.0f);
         }
@@ -571,28 +592,21 @@ void ShopObjectViewer::_SetEquipmentData()
     GlobalCharacter *character = nullptr;
     int32_t phys_diff = 0, mag_diff = 0; // Holds the difference in attack power from equipped weapon/armor to selected weapon/armor
 
-    // NOTE: In this block of code, entries to the _phys_change_text and _mag_change_text members are only modified if that information is to be
-    // displayed for the character (meaning that the character can use the weapon/armor and does not already have it equipped). This means
-    // that these two container members may contain stale data from previous objects. This is acceptable, however, as the stale data should
-    // never be drawn. The stale data is allowed to remain so that we do not waste time re-rendering text for which we will not display.
+    // NOTE: In this block of code, entries to the phys_change_text and mag_change_text members are only rendered if that information is to be
+    // displayed for the character (meaning that the character can use the weapon/armor and does not already have it equipped).
+    display.character_usable.assign(party->size(), false);
+    display.character_equipped.assign(party->size(), false);
+    display.phys_change_text.resize(party->size());
+    display.mag_change_text.resize(party->size());
     if(selected_weapon != nullptr) {
         for(uint32_t i = 0; i < party->size(); ++i) {
             character = party->at(i);
             std::shared_ptr<GlobalWeapon> equipped_weapon = character->GetWeaponEquipped();
 
-            // Initially assume that the character does not have this weapon equipped
-            _character_equipped[i] = false;
-
             // Case 1: determine if the character can use the weapon and if not, move on to the next character
-            // Toggle grayscale mode appropriately to indicate whether or not the character can equip this
-            if(usable_status & (character->GetID())) {
-                if(_character_sprites[i]->IsGrayscale())
-                    _character_sprites[i]->SetGrayscale(false);
-            } else {
-                if(!_character_sprites[i]->IsGrayscale())
-                    _character_sprites[i]->SetGrayscale(true);
+            if(!(usable_status & (character->GetID())))
                 continue;
-            }
+            display.character_usable[i] = true;
             // Case 2: if the player does not have any weapon equipped, the stat diff is equal to the selected weapon's ratings
             if(equipped_weapon == nullptr) {
                 phys_diff = static_cast<int32_t>(selected_weapon->GetPhysicalAttack());
@@ -600,7 +614,7 @@ void ShopObjectViewer::_SetEquipmentData()
             }
             // Case 3: if the player already has this weapon equipped, indicate thus and move on to the next character
             else if(selected_weapon->GetID() == equipped_weapon->GetID()) {
-                _character_equipped[i] = true;
+                display.character_equipped[i] = true;
                 continue;
             }
             // Case 4: the player can use this weapon and does not already have it equipped
@@ -619,19 +633,10 @@ void ShopObjectViewer::_SetEquipmentData()
             character = party->at(i);
             std::shared_ptr<GlobalArmor> equipped_armor = character->GetArmorEquipped(armor_index);
 
-            // Initially assume that the character does not have this armor equipped
-            _character_equipped[i] = false;
-
             // Case 1: determine if the character can use the armor and if not, move on to the next character
-            // Toggle grayscale mode appropriately to indicate whether or not the character can equip this
-            if(usable_status & (character->GetID())) {
-                if(_character_sprites[i]->IsGrayscale())
-                    _character_sprites[i]->SetGrayscale(false);
-            } else {
-                if(!_character_sprites[i]->IsGrayscale())
-                    _character_sprites[i]->SetGrayscale(true);
+            if(!(usable_status & (character->GetID())))
                 continue;
-            }
+            display.character_usable[i] = true;
             // Case 2: if the player does not have any armor equipped, the stat diff is equal to the selected armor's ratings
             if(equipped_armor == nullptr) {
                 phys_diff = static_cast<int32_t>(selected_armor->GetPhysicalDefense());
@@ -639,7 +644,7 @@ void ShopObjectViewer::_SetEquipmentData()
             }
             // Case 3: if the player already has this armor equipped, indicate thus and move on to the next character
             else if(selected_armor->GetID() == equipped_armor->GetID()) {
-                _character_equipped[i] = true;
+                display.character_equipped[i] = true;
                 continue;
             }
             // Case 4: the player can use this armor and does not already have it equipped
@@ -654,7 +659,7 @@ void ShopObjectViewer::_SetEquipmentData()
             _SetChangeText(i, phys_diff, mag_diff);
         }
     }
-} // void ShopObjectViewer::_SetEquipmentData()
+} // void ShopObjectViewer::_PrepareEquipmentData()
 
 
 
@@ -752,43 +757,43 @@ void ShopObjectViewer::ScrollDownTradeConditions()
 
 void ShopObjectViewer::_SetChangeText(uint32_t index, int32_t phys_diff, int32_t mag_diff)
 {
-    if(index >= _character_sprites.size()) {
+    if(index >= _object_display->phys_change_text.size()) {
         IF_PRINT_WARNING(SHOP_DEBUG) << "index argument was out of bounds: " << index << std::endl;
         return;
     }
 
-    _phys_change_text[index].Clear();
+    _object_display->phys_change_text[index].Clear();
     if(phys_diff > 0) {
-        _phys_change_text[index].SetStyle(TextStyle("text18", Color::green));
-        _phys_change_text[index].SetText("+" + NumberToString(phys_diff));
+        _object_display->phys_change_text[index].SetStyle(TextStyle("text18", Color::green));
+        _object_display->phys_change_text[index].SetText("+" + NumberToString(phys_diff));
     } else if(phys_diff < 0) {
-        _phys_change_text[index].SetStyle(TextStyle("text18", Color::red));
-        _phys_change_text[index].SetText(NumberToString(phys_diff));
+        _object_display->phys_change_text[index].SetStyle(TextStyle("text18", Color::red));
+        _object_display->phys_change_text[index].SetText(NumberToString(phys_diff));
     } else { // (phys_diff == 0)
-        _phys_change_text[index].SetStyle(TextStyle("text18", Color::white));
-        _phys_change_text[index].SetText(NumberToString(phys_diff));
+        _object_display->phys_change_text[index].SetStyle(TextStyle("text18", Color::white));
+        _object_display->phys_change_text[index].SetText(NumberToString(phys_diff));
     }
 
-    _mag_change_text[index].Clear();
+    _object_display->mag_change_text[index].Clear();
     if(mag_diff > 0) {
-        _mag_change_text[index].SetStyle(TextStyle("text18", Color::green));
-        _mag_change_text[index].SetText("+" + NumberToString(mag_diff));
+        _object_display->mag_change_text[index].SetStyle(TextStyle("text18", Color::green));
+        _object_display->mag_change_text[index].SetText("+" + NumberToString(mag_diff));
     } else if(mag_diff < 0) {
-        _mag_change_text[index].SetStyle(TextStyle("text18", Color::red));
-        _mag_change_text[index].SetText(NumberToString(mag_diff));
+        _object_display->mag_change_text[index].SetStyle(TextStyle("text18", Color::red));
+        _object_display->mag_change_text[index].SetText(NumberToString(mag_diff));
     } else { // (mag_diff == 0)
-        _mag_change_text[index].SetStyle(TextStyle("text18", Color::white));
-        _mag_change_text[index].SetText(NumberToString(mag_diff));
+        _object_display->mag_change_text[index].SetStyle(TextStyle("text18", Color::white));
+        _object_display->mag_change_text[index].SetText(NumberToString(mag_diff));
     }
 }
 
 void ShopObjectViewer::_SetStatusIcons(const std::vector<std::pair<GLOBAL_STATUS, GLOBAL_INTENSITY> >& status_effects)
 {
-    _status_icons.clear();
+    _object_display->status_icons.clear();
     for(std::vector<std::pair<GLOBAL_STATUS, GLOBAL_INTENSITY> >::const_iterator it = status_effects.begin();
             it != status_effects.end(); ++it) {
         if(it->second != GLOBAL_INTENSITY_NEUTRAL)
-            _status_icons.push_back(GlobalManager->Media().GetStatusIcon(it->first, it->second));
+            _object_display->status_icons.push_back(GlobalManager->Media().GetStatusIcon(it->first, it->second));
     }
 }
 
@@ -831,6 +836,8 @@ void ShopObjectViewer::_DrawItem()
 
 void ShopObjectViewer::_DrawEquipment()
 {
+    const ShopObjectDisplay& display = *_object_display;
+
     VideoManager->MoveRelative(70.0f, -15.0f);
     if (_is_weapon)
         _atk_icon->Draw();
@@ -849,14 +856,14 @@ void ShopObjectViewer::_DrawEquipment()
 
     VideoManager->SetDrawFlags(VIDEO_X_RIGHT, 0);
     VideoManager->MoveRelative(110.0f, -30.0f);
-    _phys_rating.Draw();
+    display.phys_rating.Draw();
     VideoManager->MoveRelative(0.0f, 30.0f);
-    _mag_rating.Draw();
+    display.mag_rating.Draw();
 
     VideoManager->SetDrawFlags(VIDEO_X_LEFT, 0);
     VideoManager->MoveRelative(20.0f, 0.0f);
     float j = 0;
-    for (uint32_t i = 0; i < _spirit_number; ++i) {
+    for (uint32_t i = 0; i < display.spirit_number; ++i) {
         _spirit_slot_icon->Draw();
         if (i % 2 == 0) {
             VideoManager->MoveRelative(15.0f , 0.0f);
@@ -870,18 +877,18 @@ void ShopObjectViewer::_DrawEquipment()
     VideoManager->MoveRelative(j, -65.0f);
 
     // Draw status effects icons
-    uint32_t element_size = _status_icons.size() > 9 ? 9 : _status_icons.size();
+    uint32_t element_size = display.status_icons.size() > 9 ? 9 : display.status_icons.size();
     VideoManager->MoveRelative((18.0f * element_size), 0.0f);
     for(uint32_t i = 0; i < element_size; ++i) {
-        _status_icons[i]->Draw();
+        display.status_icons[i]->Draw();
         VideoManager->MoveRelative(-18.0f, 0.0f);
     }
     VideoManager->MoveRelative(0.0f, 20.0f);
-    if (_status_icons.size() > 9) {
-        element_size = _status_icons.size();
+    if (display.status_icons.size() > 9) {
+        element_size = display.status_icons.size();
         VideoManager->MoveRelative((18.0f * (element_size - 9)), 0.0f);
         for(uint32_t i = 9; i < element_size; ++i) {
-            _status_icons[i]->Draw();
+            display.status_icons[i]->Draw();
             VideoManager->MoveRelative(-18.0f, 0.0f);
         }
     }
@@ -904,14 +911,14 @@ void ShopObjectViewer::_DrawEquipment()
     }
 
     // Draws earned skills
-    element_size = _equip_skills.size();
+    element_size = display.equip_skills.size();
     if (element_size > 0)
         _equip_skills_header.Draw();
     VideoManager->MoveRelative(10.0f, 20.0f);
     for (uint32_t i = 0; i < element_size; ++i) {
-        _equip_skills[i].Draw();
+        display.equip_skills[i].Draw();
         VideoManager->MoveRelative(-20.0f, 0.0f);
-        _equip_skill_icons[i].Draw();
+        display.equip_skill_icons[i].Draw();
         VideoManager->MoveRelative(20.0f, 20.0f);
     }
 
@@ -941,12 +948,14 @@ void ShopObjectViewer::_DrawEquipment()
     // There's only enough room to show 4 sprites
     if (max_characters > 4)
         max_characters = 4;
+    if (max_characters > display.character_equipped.size())
+        max_characters = display.character_equipped.size();
 
     for(uint32_t i = 0; i < max_characters; ++i) {
         _character_sprites[i]->Draw();
 
         // Case 1: Draw the equip icon below the character sprite
-        if(_character_equipped[i]) {
+        if(display.character_equipped[i]) {
             VideoManager->MoveRelative(0.0f, 78.0f);
             _equip_icon->Draw();
             VideoManager->MoveRelative(0.0f, -78.0f);
@@ -954,9 +963,9 @@ void ShopObjectViewer::_DrawEquipment()
         // Case 2: Draw the phys/mag change text below the sprite
         else if(!_character_sprites[i]->IsGrayscale()) {
             VideoManager->MoveRelative(0.0f, 65.0f);
-            _phys_change_text[i].Draw();
+            display.phys_change_text[i].Draw();
             VideoManager->MoveRelative(0.0f, 20.0f);
-            _mag_change_text[i].Draw();
+            display.mag_change_text[i].Draw();
             VideoManager->MoveRelative(0.0f, -85.0f);
         }
         // Case 3: Nothing needs to be drawn below the sprite
@@ -1660,7 +1669,7 @@ void ShopMode::CompleteTransaction()
             if (!shop_object->IsInfiniteAmount())
                 shop_object->IncrementStockCount(count);
         } else {
-            std::shared_ptr<GlobalObject> new_object = GlobalCreateNewObject(id, 1);
+            std::shared_ptr<GlobalObject> new_object = ShopCatalog::GetObject(id);
             if (new_object != nullptr) {
                 ShopObject* new_shop_object = new ShopObject(new_object);
                 new_shop_object->IncrementStockCount(count);
@@ -1852,7 +1861,7 @@ void ShopMode::AddItem(uint32_t object_id, uint32_t stock)
         return;
     }
 
-    std::shared_ptr<GlobalObject> new_object = GlobalCreateNewObject(object_id, 1);
+    std::shared_ptr<GlobalObject> new_object = ShopCatalog::GetObject(object_id);
     if (new_object != nullptr) {
         ShopObject *new_shop_object = new ShopObject(new_object);
         if (stock > 0)
@@ -1880,7 +1889,7 @@ void ShopMode::AddTrade(uint32_t object_id, uint32_t stock)
         return;
     }
 
-    std::shared_ptr<GlobalObject> new_object = GlobalCreateNewObject(object_id, 1);
+    std::shared_ptr<GlobalObject> new_object = ShopCatalog::GetObject(object_id);
     if (new_object != nullptr) {
         ShopObject *new_shop_object = new ShopObject(new_object);
         if (stock > 0)
@@ -102,6 +102,59 @@ private:
 }; // class ShopMedia
 
 
+/** ****************************************************************************
+*** \brief The rendered display data of a shop object
+***
+*** The name and, for equipment, the comparison against what the party has
+*** equipped are computed and rendered the first time the object is selected.
+*** The party equipment doesn't change during a shop visit, so moving the cursor
+*** afterwards only swaps this prepared data.
+*** ***************************************************************************/
+class ShopObjectDisplay
+{
+public:
+    ShopObjectDisplay() :
+        prepared(false),
+        is_weapon(false),
+        spirit_number(0)
+    {}
+
+    //! \brief Tells whether the data below has already been computed
+    bool prepared;
+
+    //! \brief The rendered name of the object
+    vt_video::TextImage name;
+
+    //! \name Data used only for weapon and armor object types
+    //@{
+    //! \brief Tells whether the equipment is a weapon or a piece of armor
+    bool is_weapon;
+
+    //! \brief A rendering of the physical and magical attack/defense ratings
+    vt_video::TextImage phys_rating, mag_rating;
+
+    //! \brief The number of spirit the equipment can support.
+    uint32_t spirit_number;
+
+    //! \brief Icon images representing status effects and intensity properties of the object
+    std::vector<vt_video::StillImage *> status_icons;
+
+    //! \brief The skills earned when equipping
+    std::vector<vt_video::TextImage> equip_skills;
+    std::vector<vt_video::StillImage> equip_skill_icons;
+
+    //! \brief Tells for each character whether they can use the equipment
+    std::vector<bool> character_usable;
+
+    //! \brief Tells for each character whether they already have the equipment equipped
+    std::vector<bool> character_equipped;
+
+    //! \brief For each character, text to indicate changes in phys/mag stats from current equipment
+    std::vector<vt_video::TextImage> phys_change_text, mag_change_text;
+    //@}
+}; // class ShopObjectDisplay
+
+
 /** ****************************************************************************
 *** \brief Manages all data and graphics for showing detailed information about an object
 ***
@@ -179,10 +232,14 @@ private:
     //! \brief When the object type is equipment, this tells whether it is a weapon.
     bool _is_weapon;
 
+    //! \brief The display data prepared for each object selected during this visit, sorted by object id
+    std::map<uint32_t, ShopObjectDisplay> _object_displays;
+
+    //! \brief The display data of the selected object
+    ShopObjectDisplay *_object_display;
+
     //! \name Data that all object types share
     //@{
-    //! \brief The name of the selected object
-    vt_video::TextImage _object_name;
 
     //! \brief A summary description of the object to display
     vt_gui::TextBox _description_text;
@@ -225,9 +282,6 @@ private:
     //! \brief Header text identifying the physical and magical ratings
     vt_video::TextImage _phys_header, _mag_header;
 
-    //! \brief A rendering of the physical and magical attack/defense ratings
-    vt_video::TextImage _phys_rating, _mag_rating;
-
     //! \brief An icon image of a spirit slot
     vt_video::StillImage *_spirit_slot_icon;
 
@@ -240,16 +294,8 @@ private:
     vt_video::StillImage *_def_icon;
     vt_video::StillImage *_mdef_icon;
 
-    //! \brief The number of spirit the equipment can support.
-    uint32_t _spirit_number;
-
-    //! \brief Icon images representing status effects and intensity properties of the selected object
-    std::vector<vt_video::StillImage *> _status_icons;
-
-    //! \brief The skills earned when equipping
+    //! \brief The header of the skills earned when equipping
     vt_video::TextImage _equip_skills_header;
-    std::vector<vt_video::TextImage> _equip_skills;
-    std::vector<vt_video::StillImage> _equip_skill_icons;
     //@}
 
     //! \name Data used for displaying character sprites and related status
@@ -260,11 +306,6 @@ private:
     //! \brief For weapons and armor, icon image that represents when a character already has the object equipped
     vt_video::StillImage *_equip_icon;
 
-    //! \brief For weapons and armor, this member is set to true for each character that has the object equipped
-    std::vector<bool> _character_equipped;
-
-    //! \brief For weapons and armor, text to indicate changes in phys/mag stats from current equipment
-    std::vector<vt_video::TextImage> _phys_change_text, _mag_change_text;
     //@}
 
     /** \brief Updates the condition list.
@@ -282,6 +323,12 @@ private:
     **/
     void _SetEquipmentData();
 
+    /** \brief Computes the equipment ratings and the comparison against each character's equipment
+    *** and renders the related texts in the selected object display data.
+    *** This method should only be called if the _selected_object member is a weapon or armor
+    **/
+    void _PrepareEquipmentData();
+
     /** \brief Updates the data and visuals associated specifically with spirits for the selected object
     *** This method should only be called if the _selected_object member is a spirit
     **/
@@ -293,8 +340,8 @@ private:
     //! \brief Determines the hint text content
     void _SetHintText();
 
-    /** \brief Renders the desired physical and magical change text
-    *** \param index The index into the _phys_change_text and _mag_change_text containers to re-render
+    /** \brief Renders the desired physical and magical change text in the selected object display data
+    *** \param index The character index into the phys_change_text and mag_change_text containers to render
     *** \param phys_diff The physical change amount
     *** \param mag_diff The magical change amount
     **/
@@ -321,6 +321,37 @@ void ShopObject::DecrementTradeCount(uint32_t dec)
     }
 }
 
+// *****************************************************************************
+// ***** ShopCatalog class methods
+// *****************************************************************************
+
+std::map<uint32_t, std::shared_ptr<GlobalObject> > ShopCatalog::_objects;
+uint32_t ShopCatalog::_locale_generation = 0;
+
+std::shared_ptr<GlobalObject> ShopCatalog::GetObject(uint32_t object_id)
+{
+    // The cached objects names and descriptions are outdated after a language change.
+    if(_locale_generation != SystemManager->GetLocaleGeneration()) {
+        _objects.clear();
+        _locale_generation = SystemManager->GetLocaleGeneration();
+    }
+
+    std::map<uint32_t, std::shared_ptr<GlobalObject> >::const_iterator it = _objects.find(object_id);
+    if(it != _objects.end())
+        return it->second;
+
+    std::shared_ptr<GlobalObject> object = GlobalCreateNewObject(object_id, 1);
+    // Don't cache invalid ids so the error is reported each time.
+    if(object != nullptr)
+        _objects.insert(std::make_pair(object_id, object));
+    return object;
+}
+
+void ShopCatalog::Clear()
+{
+    _objects.clear();
+}
+
 // *****************************************************************************
 // ***** ObjectCategoryDisplay class methods
 // *****************************************************************************
@@ -303,6 +303,37 @@ private:
     uint32_t _trade_count;
 };
 
+/** ****************************************************************************
+*** \brief Keeps the global objects displayed by shops across visits
+***
+*** Creating a global object reads its whole definition from the object scripts,
+*** which makes large shops slow to open. The objects used by shops only serve
+*** for display: buying adds new objects to the inventory by id.
+*** They are thus created once and shared by every shop and later visits.
+***
+*** \note The objects hold translated texts, so the catalog is emptied
+*** whenever the language changes.
+*** ***************************************************************************/
+class ShopCatalog
+{
+public:
+    /** \brief Returns the shared display object of the given id, creating it on first request.
+    *** \param object_id The id of the global object wanted
+    *** \return The object, or nullptr if it couldn't be created
+    **/
+    static std::shared_ptr<vt_global::GlobalObject> GetObject(uint32_t object_id);
+
+    //! \brief Frees every cached object
+    static void Clear();
+
+private:
+    //! \brief The cached objects, sorted by id
+    static std::map<uint32_t, std::shared_ptr<vt_global::GlobalObject> > _objects;
+
+    //! \brief The system locale generation the cached objects were created with
+    static uint32_t _locale_generation;
+};
+
 /** ****************************************************************************
 *** \brief Displays text and an icon image to represent an object category
 ***
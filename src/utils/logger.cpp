@@ -0,0 +1,526 @@
+////////////////////////////////////////////////////////////////////////////////
+//            Copyright (C) 2012-2016 by Bertram (Valyria Tear)
+//                         All Rights Reserved
+//
+// This code is licensed under the GNU GPL version 2. It is free software
+// and you may modify it and/or redistribute it under the terms of this license.
+// See http://www.gnu.org/copyleft/gpl.html for details.
+////////////////////////////////////////////////////////////////////////////////
+
+/** ****************************************************************************
+*** \file   logger.cpp
+*** \author Valyria Tear team, https://github.com/ValyriaTear/ValyriaTear/issues
+*** \brief  Source file for the asynchronous log
+*** ***************************************************************************/
+
+#include "utils/utils_pch.h"
+#include "logger.h"
+
+namespace vt_utils
+{
+
+namespace private_utils
+{
+
+//! \brief The number of messages each thread ring buffer can hold.
+const uint32_t LOG_RING_SIZE = 256;
+
+//! \brief The number of call site messages tracked by the rate limit.
+const uint32_t LOG_SITES_SIZE = 1024;
+
+//! \brief The time the writer thread waits between two checks for new messages, in milliseconds.
+const uint32_t LOG_WRITER_PERIOD = 50;
+
+//! \brief The log lifetime states
+enum LOG_STATE {
+    LOG_STATE_UNINITIALIZED = 0,
+    LOG_STATE_RUNNING = 1,
+    //! \brief The messages are written synchronously.
+    LOG_STATE_STOPPED = 2
+};
+
+//! \brief The severity names, indexed by LOG_SEVERITY.
+const char *const LOG_SEVERITY_NAMES[] = { "DEBUG", "WARNING", "ERROR" };
+
+//! \brief A log message waiting to be written
+class LogRecord
+{
+public:
+    LOG_SEVERITY severity;
+
+    const char *category;
+    const char *file;
+    const char *function;
+    int32_t line;
+
+    //! \brief The number of messages of the call site dropped by the rate limit before this one.
+    uint32_t suppressed;
+
+    char text[LOG_MESSAGE_LENGTH];
+};
+
+/** ****************************************************************************
+*** \brief A single producer, single consumer ring buffer of log messages
+***
+*** Only its thread pushes messages and only the writer thread pops them, so that
+*** neither of them ever waits on the other. When the ring is full, the new
+*** messages are dropped and counted.
+*** ***************************************************************************/
+class LogRing
+{
+public:
+    LogRing() :
+        next(nullptr)
+    {
+        SDL_AtomicSet(&head, 0);
+        SDL_AtomicSet(&tail, 0);
+        SDL_AtomicSet(&dropped, 0);
+    }
+
+    LogRecord records[LOG_RING_SIZE];
+
+    //! \brief The number of messages pushed and popped.
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+
+    //! \brief The number of messages dropped because the ring was full.
+    SDL_atomic_t dropped;
+
+    //! \brief The next ring in the rings list.
+    LogRing *next;
+};
+
+//! \brief The rate limit state of a message of a call site
+class LogSite
+{
+public:
+    //! \brief Guards the other members, as any thread may take the entry over.
+    SDL_SpinLock lock;
+
+    const char *file;
+    int32_t line;
+
+    //! \brief The hash of the message text.
+    uint32_t text_hash;
+
+    //! \brief The time the current rate limit window started at, in milliseconds.
+    uint32_t window_start;
+
+    //! \brief The number of messages emitted during the current window.
+    uint32_t count;
+
+    //! \brief The number of messages dropped since the last one emitted.
+    uint32_t suppressed;
+};
+
+static SDL_atomic_t log_state;
+static SDL_SpinLock log_init_lock = 0;
+
+//! \brief The thread local storage ids of the threads rings and spare formatters.
+static SDL_TLSID log_ring_id = 0;
+static SDL_TLSID log_formatter_id = 0;
+
+//! \brief The rings of all the threads which emitted messages. They are only freed at exit.
+static void *log_rings = nullptr;
+
+static SDL_Thread *log_writer = nullptr;
+static SDL_sem *log_writer_wake = nullptr;
+static SDL_atomic_t log_writer_stop;
+
+//! \brief Protects the outputs and the reading of the rings, done by the writer thread
+//! or synchronously. SDL mutexes are recursive.
+static SDL_mutex *log_output_mutex = nullptr;
+static std::ofstream log_file;
+
+static LogSite log_sites[LOG_SITES_SIZE];
+
+//! \brief The settings, only changed at startup.
+static LOG_SEVERITY log_minimum_severity = LOG_DEBUG;
+static bool log_console_output = true;
+
+void LogFormatter::Reset()
+{
+    buffer.Reset();
+    stream.clear();
+    stream.flags(std::ios_base::skipws | std::ios_base::dec);
+    stream.precision(6);
+    stream.width(0);
+    stream.fill(' ');
+}
+
+//! \brief Writes the messages to the console and the log file.
+static void WriteOutput(const std::string &text)
+{
+    if(log_output_mutex)
+        SDL_LockMutex(log_output_mutex);
+
+    if(log_console_output) {
+        std::cout << text;
+        std::cout.flush();
+    }
+    if(log_file.is_open()) {
+        log_file << text;
+        log_file.flush();
+    }
+
+    if(log_output_mutex)
+        SDL_UnlockMutex(log_output_mutex);
+}
+
+//! \brief Formats a message as `SEVERITY:CATEGORY:FILE:FUNCTION:LINE: ` followed by the message on the next line.
+static void FormatRecord(LOG_SEVERITY severity, const char *category, const char *file, const char *function,
+                         int32_t line, uint32_t suppressed, const char *text, std::ostream &output)
+{
+    output << LOG_SEVERITY_NAMES[severity] << ":";
+    if(category) {
+        // The categories are the debug flags names: VIDEO_DEBUG is shown as VIDEO.
+        const char *suffix = strstr(category, "_DEBUG");
+        if(suffix)
+            output.write(category, suffix - category);
+        else
+            output << category;
+        output << ":";
+    }
+    output << file << ":" << function << ":" << line << ": \n";
+
+    if(suppressed > 0)
+        output << "(" << suppressed << " similar messages were suppressed)\n";
+
+    size_t length = strlen(text);
+    output.write(text, length);
+    if(length == 0 || text[length - 1] != '\n')
+        output << "\n";
+}
+
+static void FormatRecord(const LogRecord &record, std::ostream &output)
+{
+    FormatRecord(record.severity, record.category, record.file, record.function,
+                 record.line, record.suppressed, record.text, output);
+}
+
+//! \brief Writes the messages of all the rings.
+static void DrainRings()
+{
+    // Only one thread may read the rings at a time.
+    if(log_output_mutex)
+        SDL_LockMutex(log_output_mutex);
+
+    std::ostringstream output;
+
+    for(LogRing *ring = static_cast<LogRing *>(SDL_AtomicGetPtr(&log_rings)); ring != nullptr; ring = ring->next) {
+        uint32_t tail = static_cast<uint32_t>(SDL_AtomicGet(&ring->tail));
+        uint32_t head = static_cast<uint32_t>(SDL_AtomicGet(&ring->head));
+        // Don't read the records before their thread published them.
+        SDL_MemoryBarrierAcquire();
+
+        for(; tail != head; ++tail)
+            FormatRecord(ring->records[tail % LOG_RING_SIZE], output);
+
+        // Give the records back once read.
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&ring->tail, static_cast<int>(tail));
+
+        int dropped = SDL_AtomicSet(&ring->dropped, 0);
+        if(dropped > 0)
+            output << "WARNING: " << dropped << " log messages were dropped because the log buffer was full.\n";
+    }
+
+    std::string text = output.str();
+    if(!text.empty())
+        WriteOutput(text);
+
+    if(log_output_mutex)
+        SDL_UnlockMutex(log_output_mutex);
+}
+
+static int WriterThread(void *)
+{
+    while(SDL_AtomicGet(&log_writer_stop) == 0) {
+        DrainRings();
+        SDL_SemWaitTimeout(log_writer_wake, LOG_WRITER_PERIOD);
+    }
+    DrainRings();
+    return 0;
+}
+
+//! \brief Starts the writer thread on the first message. Returns whether messages are written asynchronously.
+static bool InitializeLog()
+{
+    int state = SDL_AtomicGet(&log_state);
+    if(state != LOG_STATE_UNINITIALIZED)
+        return (state == LOG_STATE_RUNNING);
+
+    SDL_AtomicLock(&log_init_lock);
+    if(SDL_AtomicGet(&log_state) == LOG_STATE_UNINITIALIZED) {
+        log_ring_id = SDL_TLSCreate();
+        log_formatter_id = SDL_TLSCreate();
+        log_output_mutex = SDL_CreateMutex();
+        log_writer_wake = SDL_CreateSemaphore(0);
+        SDL_AtomicSet(&log_writer_stop, 0);
+
+        if(log_ring_id != 0 && log_writer_wake != nullptr)
+            log_writer = SDL_CreateThread(WriterThread, "Log", nullptr);
+
+        SDL_AtomicSet(&log_state, log_writer ? LOG_STATE_RUNNING : LOG_STATE_STOPPED);
+        atexit(ShutdownLog);
+    }
+    SDL_AtomicUnlock(&log_init_lock);
+
+    return (SDL_AtomicGet(&log_state) == LOG_STATE_RUNNING);
+}
+
+//! \brief Returns the FNV-1a hash of the message text.
+static uint32_t HashText(const char *text)
+{
+    uint32_t hash = 2166136261u;
+    for(; *text != '\0'; ++text) {
+        hash ^= static_cast<uint8_t>(*text);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/** \brief Applies the rate limit to the repetitions of a message of a call site.
+*** \param suppressed Set to the number of repetitions dropped since the last one emitted
+*** \return whether the message should be emitted
+**/
+static bool AcceptMessage(const char *file, int32_t line, const char *text, uint32_t &suppressed)
+{
+    // The file name literal address and the line are enough to tell the call sites apart.
+    const uint32_t text_hash = HashText(text);
+    uintptr_t hash = reinterpret_cast<uintptr_t>(file) ^ (static_cast<uintptr_t>(line) * 2654435761u) ^ text_hash;
+    LogSite &site = log_sites[hash % LOG_SITES_SIZE];
+    uint32_t now = SDL_GetTicks();
+    bool accepted = true;
+
+    SDL_AtomicLock(&site.lock);
+    if(site.file != file || site.line != line || site.text_hash != text_hash) {
+        // The entry was used by another message: Take it over.
+        site.file = file;
+        site.line = line;
+        site.text_hash = text_hash;
+        site.window_start = now;
+        site.count = 0;
+        site.suppressed = 0;
+    } else if(now - site.window_start >= LOG_RATE_WINDOW) {
+        site.window_start = now;
+        site.count = 0;
+    }
+
+    if(site.count < LOG_RATE_LIMIT) {
+        ++site.count;
+        suppressed = site.suppressed;
+        site.suppressed = 0;
+    } else {
+        ++site.suppressed;
+        accepted = false;
+    }
+    SDL_AtomicUnlock(&site.lock);
+
+    return accepted;
+}
+
+static void DeleteFormatter(void *formatter)
+{
+    delete static_cast<LogFormatter *>(formatter);
+}
+
+//! \brief Returns the thread spare formatter, or a new one when it is already used by an enclosing message.
+static LogFormatter *AcquireFormatter()
+{
+    LogFormatter *formatter = static_cast<LogFormatter *>(SDL_TLSGet(log_formatter_id));
+    if(formatter == nullptr)
+        return new LogFormatter();
+
+    SDL_TLSSet(log_formatter_id, nullptr, nullptr);
+    return formatter;
+}
+
+static void ReleaseFormatter(LogFormatter *formatter)
+{
+    formatter->Reset();
+    if(SDL_TLSGet(log_formatter_id) != nullptr || SDL_TLSSet(log_formatter_id, formatter, DeleteFormatter) != 0)
+        delete formatter;
+}
+
+//! \brief Returns the calling thread ring, creating it on the thread first message.
+static LogRing *GetThreadRing()
+{
+    LogRing *ring = static_cast<LogRing *>(SDL_TLSGet(log_ring_id));
+    if(ring)
+        return ring;
+
+    ring = new LogRing();
+    // The ring isn't freed with its thread, as the writer thread may still be reading it.
+    if(SDL_TLSSet(log_ring_id, ring, nullptr) != 0) {
+        delete ring;
+        return nullptr;
+    }
+
+    // Publish the ring to the writer thread.
+    void *rings = nullptr;
+    do {
+        rings = SDL_AtomicGetPtr(&log_rings);
+        ring->next = static_cast<LogRing *>(rings);
+    } while(SDL_AtomicCASPtr(&log_rings, rings, ring) == SDL_FALSE);
+
+    return ring;
+}
+
+static void FillRecord(LogRecord &record, LOG_SEVERITY severity, const char *category,
+                       const char *file, const char *function, int32_t line,
+                       uint32_t suppressed, const char *text)
+{
+    record.severity = severity;
+    record.category = category;
+    record.file = file;
+    record.function = function;
+    record.line = line;
+    record.suppressed = suppressed;
+    strncpy(record.text, text, LOG_MESSAGE_LENGTH - 1);
+    record.text[LOG_MESSAGE_LENGTH - 1] = '\0';
+}
+
+} // namespace private_utils
+
+using namespace private_utils;
+
+LogStream::LogStream(LOG_SEVERITY severity, const char *category, const char *file, const char *function, int32_t line) :
+    _formatter(nullptr),
+    _severity(severity),
+    _category(category),
+    _file(file),
+    _function(function),
+    _line(line)
+{
+    if(severity < log_minimum_severity)
+        return;
+
+    InitializeLog();
+    _formatter = AcquireFormatter();
+}
+
+LogStream::~LogStream()
+{
+    if(_formatter == nullptr)
+        return;
+
+    const char *text = _formatter->buffer.GetText();
+
+    // Errors are never dropped.
+    uint32_t suppressed = 0;
+    if(_severity != LOG_ERROR && !AcceptMessage(_file, _line, text, suppressed)) {
+        ReleaseFormatter(_formatter);
+        return;
+    }
+
+    LogRing *ring = nullptr;
+    if(SDL_AtomicGet(&log_state) == LOG_STATE_RUNNING)
+        ring = GetThreadRing();
+
+    if(ring == nullptr || _severity == LOG_ERROR || _formatter->buffer.IsLong()) {
+        // Errors are written right away, as the game may exit soon after,
+        // and the messages too long for a record as well.
+        // This is also the fallback when the writer thread isn't available.
+        std::ostringstream output;
+        FormatRecord(_severity, _category, _file, _function, _line, suppressed, text, output);
+
+        // Write the pending messages first, to keep the messages order.
+        if(log_output_mutex)
+            SDL_LockMutex(log_output_mutex);
+        if(ring != nullptr)
+            DrainRings();
+        WriteOutput(output.str());
+        if(log_output_mutex)
+            SDL_UnlockMutex(log_output_mutex);
+    } else {
+        uint32_t head = static_cast<uint32_t>(SDL_AtomicGet(&ring->head));
+        uint32_t tail = static_cast<uint32_t>(SDL_AtomicGet(&ring->tail));
+        if(head - tail >= LOG_RING_SIZE) {
+            // Never wait for the writer thread.
+            SDL_AtomicAdd(&ring->dropped, 1);
+        } else {
+            FillRecord(ring->records[head % LOG_RING_SIZE], _severity, _category, _file, _function, _line, suppressed, text);
+
+            // Publish the record once it is written.
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicSet(&ring->head, static_cast<int>(head + 1));
+        }
+    }
+
+    ReleaseFormatter(_formatter);
+}
+
+void SetLogMinimumSeverity(LOG_SEVERITY severity)
+{
+    log_minimum_severity = severity;
+}
+
+void SetLogConsoleOutput(bool enabled)
+{
+    log_console_output = enabled;
+}
+
+bool SetLogFile(const std::string &filename)
+{
+    InitializeLog();
+
+    if(log_output_mutex)
+        SDL_LockMutex(log_output_mutex);
+
+    if(log_file.is_open())
+        log_file.close();
+
+    bool success = true;
+    if(!filename.empty()) {
+        log_file.open(filename.c_str(), std::ios::out | std::ios::trunc);
+        success = log_file.is_open();
+    }
+
+    if(log_output_mutex)
+        SDL_UnlockMutex(log_output_mutex);
+
+    if(!success)
+        PRINT_ERROR << "Couldn't open the log file: " << filename << std::endl;
+    return success;
+}
+
+void ShutdownLog()
+{
+    SDL_AtomicLock(&log_init_lock);
+
+    if(SDL_AtomicGet(&log_state) == LOG_STATE_RUNNING) {
+        // The next messages are written synchronously.
+        SDL_AtomicSet(&log_state, LOG_STATE_STOPPED);
+
+        SDL_AtomicSet(&log_writer_stop, 1);
+        SDL_SemPost(log_writer_wake);
+        SDL_WaitThread(log_writer, nullptr);
+        log_writer = nullptr;
+
+        // Write the messages pushed while the writer was stopping.
+        DrainRings();
+
+        // Report the messages dropped since the last ones of their call sites.
+        std::ostringstream output;
+        for(uint32_t i = 0; i < LOG_SITES_SIZE; ++i) {
+            LogSite &site = log_sites[i];
+            SDL_AtomicLock(&site.lock);
+            if(site.suppressed > 0) {
+                output << "WARNING:" << site.file << ":" << site.line << ": \n"
+                       << site.suppressed << " similar messages were suppressed.\n";
+                site.suppressed = 0;
+            }
+            SDL_AtomicUnlock(&site.lock);
+        }
+        std::string text = output.str();
+        if(!text.empty())
+            WriteOutput(text);
+    } else {
+        SDL_AtomicSet(&log_state, LOG_STATE_STOPPED);
+    }
+
+    SDL_AtomicUnlock(&log_init_lock);
+}
+
+} // namespace vt_utils
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////
+//            Copyright (C) 2012-2016 by Bertram (Valyria Tear)
+//                         All Rights Reserved
+//
+// This code is licensed under the GNU GPL version 2. It is free software
+// and you may modify it and/or redistribute it under the terms of this license.
+// See http://www.gnu.org/copyleft/gpl.html for details.
+////////////////////////////////////////////////////////////////////////////////
+
+/** ****************************************************************************
+*** \file   logger.h
+*** \author Valyria Tear team, https://github.com/ValyriaTear/ValyriaTear/issues
+*** \brief  Header file for the asynchronous log
+***
+*** The messages written through the PRINT_* and IF_PRINT_* macros are formatted
+*** on the emitting thread into a per-thread ring buffer, and written to the
+*** console and/or the log file by a background writer thread. Hence, logging
+*** never waits on the terminal or the disk.
+***
+*** Each call site may only repeat the same message a few times per second: the
+*** following repetitions are dropped and counted, and their number is reported
+*** along with the next one written.
+***
+*** Errors are never dropped, and are written synchronously after the pending
+*** messages, as the game may exit right after them.
+*** ***************************************************************************/
+
+#ifndef __LOGGER_HEADER__
+#define __LOGGER_HEADER__
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+namespace vt_utils
+{
+
+//! \brief The severity of the log messages, from the least to the most important
+enum LOG_SEVERITY {
+    LOG_DEBUG = 0,
+    LOG_WARNING = 1,
+    LOG_ERROR = 2
+};
+
+//! \brief The maximum length of a log message written asynchronously, longer messages are written synchronously.
+const uint32_t LOG_MESSAGE_LENGTH = 512;
+
+//! \brief The number of times a call site may emit the same message during each rate limit window.
+const uint32_t LOG_RATE_LIMIT = 10;
+
+//! \brief The duration of the rate limit window, in milliseconds.
+const uint32_t LOG_RATE_WINDOW = 1000;
+
+namespace private_utils
+{
+
+//! \brief A stream buffer writing in a fixed size array, spilling long messages to a string.
+class LogBuffer : public std::streambuf
+{
+public:
+    LogBuffer() {
+        Reset();
+    }
+
+    //! \brief Empties the buffer.
+    void Reset() {
+        _long_text.clear();
+        setp(_text, _text + LOG_MESSAGE_LENGTH - 1);
+    }
+
+    //! \brief Returns the null-terminated message.
+    const char* GetText() {
+        if(_long_text.empty()) {
+            *pptr() = '\0';
+            return _text;
+        }
+
+        _long_text.append(pbase(), pptr());
+        setp(_text, _text + LOG_MESSAGE_LENGTH - 1);
+        return _long_text.c_str();
+    }
+
+    //! \brief Tells whether the message didn't fit in the fixed size array.
+    bool IsLong() const {
+        return !_long_text.empty();
+    }
+
+protected:
+    //! \brief Moves the array content to the string when full.
+    virtual int_type overflow(int_type c) override {
+        _long_text.append(pbase(), pptr());
+        setp(_text, _text + LOG_MESSAGE_LENGTH - 1);
+        if(!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+private:
+    char _text[LOG_MESSAGE_LENGTH];
+
+    //! \brief The message start, when longer than the array.
+    std::string _long_text;
+};
+
+//! \brief Formats a log message. Formatters are reused by their thread.
+class LogFormatter
+{
+public:
+    LogFormatter() :
+        stream(&buffer)
+    {}
+
+    //! \brief Empties the buffer and restores the default stream state and format.
+    void Reset();
+
+    LogBuffer buffer;
+
+    std::ostream stream;
+};
+
+} // namespace private_utils
+
+/** ****************************************************************************
+*** \brief A log message being written
+***
+*** The message is formatted with the << operator, like for a std::ostream,
+*** and is sent to the writer thread when the object is destroyed, at the end
+*** of the statement. Messages filtered out by their severity are never formatted.
+*** ***************************************************************************/
+class LogStream
+{
+public:
+    /** \param severity The message severity
+    *** \param category The name of the debug flag enabling the message, or nullptr
+    *** \param file, function, line The message call site
+    **/
+    LogStream(LOG_SEVERITY severity, const char *category, const char *file, const char *function, int32_t line);
+
+    ~LogStream();
+
+    template <typename T>
+    LogStream& operator<<(const T& value) {
+        if(_formatter)
+            _formatter->stream << value;
+        return *this;
+    }
+
+    //! \brief Handles the stream manipulators, such as std::endl.
+    LogStream& operator<<(std::ostream& (*manipulator)(std::ostream&)) {
+        if(_formatter)
+            manipulator(_formatter->stream);
+        return *this;
+    }
+
+private:
+    //! \brief The message formatter, or nullptr when the message is filtered out.
+    private_utils::LogFormatter *_formatter;
+
+    LOG_SEVERITY _severity;
+    const char *_category;
+    const char *_file;
+    const char *_function;
+    int32_t _line;
+
+    LogStream(const LogStream &copy);
+    LogStream &operator=(const LogStream &copy);
+};
+
+//! \brief Sets the least severity of the messages written. Defaults to LOG_DEBUG.
+void SetLogMinimumSeverity(LOG_SEVERITY severity);
+
+//! \brief Enables or disables writing the messages to the console. Enabled by default.
+void SetLogConsoleOutput(bool enabled);
+
+/** \brief Writes the messages to the given file, in addition to the console
+*** \param filename The file to write to, or an empty string to stop writing to a file
+*** \return False if the file couldn't be opened
+**/
+bool SetLogFile(const std::string &filename);
+
+/** \brief Stops the writer thread after it wrote all the pending messages
+*** This is called automatically when the program exits. The messages emitted
+*** afterwards are written synchronously.
+**/
+void ShutdownLog();
+
+} // namespace vt_utils
+
+#endif // __LOGGER_HEADER__
@@ -523,4 +523,126 @@ const std::string GetSettingsFilename()
     return _config_filename;
 }
 
+// Static variables storing the save files catalog
+static std::map<uint32_t, SaveFileInfo> _save_files;
+static std::map<uint32_t, SaveFileInfo> _autosave_files;
+static bool _save_catalog_valid = false;
+static uint32_t _save_catalog_dir_time = 0;
+
+std::string GetSaveFilename(uint32_t slot_id, bool autosave)
+{
+    std::ostringstream filename;
+    filename << GetUserDataPath() + "saved_game_" << slot_id;
+    if (autosave)
+        filename << "_autosave.lua";
+    else
+        filename << ".lua";
+    return filename.str();
+}
+
+//! \brief Returns the modification time of the user data directory, or 0 when unknown.
+static uint32_t _GetUserDataDirTime()
+{
+    // Remove the trailing slash, since stat() doesn't handle it on every system.
+    std::string dir_name = GetUserDataPath();
+    if (!dir_name.empty() && dir_name[dir_name.length() - 1] == '/')
+        dir_name.erase(dir_name.length() - 1);
+
+    struct stat attrib;
+    if (stat(dir_name.c_str(), &attrib) != 0)
+        return 0;
+    return static_cast<uint32_t>(attrib.st_mtime);
+}
+
+/** \brief Parses a save filename such as "saved_game_2.lua" or "saved_game_2_autosave.lua"
+*** \return false when the filename isn't the one of a save file.
+**/
+static bool _ParseSaveFilename(const std::string& filename, uint32_t& slot_id, bool& autosave)
+{
+    const std::string prefix = "saved_game_";
+    if (filename.compare(0, prefix.length(), prefix) != 0)
+        return false;
+
+    size_t id_end = prefix.length();
+    while (id_end < filename.length() && isdigit(filename[id_end]))
+        ++id_end;
+    if (id_end == prefix.length())
+        return false;
+
+    std::string suffix = filename.substr(id_end);
+    if (suffix == ".lua")
+        autosave = false;
+    else if (suffix == "_autosave.lua")
+        autosave = true;
+    else
+        return false;
+
+    slot_id = static_cast<uint32_t>(atoi(filename.substr(prefix.length(), id_end - prefix.length()).c_str()));
+    return true;
+}
+
+//! \brief Lists the user data directory once and stores the save files information.
+static void _ScanSaveFiles()
+{
+    _save_files.clear();
+    _autosave_files.clear();
+    _save_catalog_dir_time = _GetUserDataDirTime();
+    _save_catalog_valid = true;
+
+    const std::string data_path = GetUserDataPath();
+    std::vector<std::string> files = ListDirectory(data_path, "saved_game_");
+    for (uint32_t i = 0; i < files.size(); ++i) {
+        uint32_t slot_id = 0;
+        bool autosave = false;
+        if (!_ParseSaveFilename(files[i], slot_id, autosave))
+            continue;
+
+        struct stat attrib;
+        if (stat((data_path + files[i]).c_str(), &attrib) != 0)
+            continue;
+
+        SaveFileInfo info;
+        info.exists = true;
+        info.size = static_cast<uint32_t>(attrib.st_size);
+        info.mod_time = static_cast<uint32_t>(attrib.st_mtime);
+
+        if (autosave)
+            _autosave_files[slot_id] = info;
+        else
+            _save_files[slot_id] = info;
+    }
+}
+
+void RefreshSaveFileCatalog()
+{
+    if (!_save_catalog_valid) {
+        _ScanSaveFiles();
+        return;
+    }
+
+    // A directory time of 0 means it is unknown, so we only rely on invalidations then.
+    uint32_t dir_time = _GetUserDataDirTime();
+    if (dir_time != 0 && dir_time != _save_catalog_dir_time)
+        _ScanSaveFiles();
+}
+
+void InvalidateSaveFileCatalog()
+{
+    _save_catalog_valid = false;
+}
+
+const SaveFileInfo& GetSaveFileInfo(uint32_t slot_id, bool autosave)
+{
+    static const SaveFileInfo no_file;
+
+    if (!_save_catalog_valid)
+        _ScanSaveFiles();
+
+    const std::map<uint32_t, SaveFileInfo>& files = autosave ? _autosave_files : _save_files;
+    std::map<uint32_t, SaveFileInfo>::const_iterator it = files.find(slot_id);
+    if (it == files.end())
+        return no_file;
+    return it->second;
+}
+
 } // namespace utils
@@ -102,6 +102,52 @@ const std::string GetUserConfigPath();
 const std::string GetSettingsFilename();
 //@}
 
+//! \name Save files catalog
+//! The save files of the user data directory are scanned once and kept in a catalog,
+//! so that the boot and save menus don't query the file system for every save slot.
+//@{
+//! \brief Information about a save file found in the user data directory.
+struct SaveFileInfo {
+    SaveFileInfo():
+        exists(false),
+        size(0),
+        mod_time(0)
+    {}
+
+    //! \brief Whether the save file exists
+    bool exists;
+
+    //! \brief The file size in bytes
+    uint32_t size;
+
+    //! \brief The file latest modification time, only meant to compare save files together
+    uint32_t mod_time;
+};
+
+/** \brief Gives the path and filename of a save slot file
+*** \param slot_id The save slot id
+*** \param autosave Whether the autosave filename of the slot is requested
+**/
+std::string GetSaveFilename(uint32_t slot_id, bool autosave = false);
+
+/** \brief Scans the user data directory save files if it changed since the last scan.
+*** This costs a single directory status query when nothing changed. Call it once when
+*** setting up a menu presenting the save slots.
+**/
+void RefreshSaveFileCatalog();
+
+/** \brief Marks the save files catalog as outdated, so that the next refresh will rescan the directory.
+*** \note Call this after writing or deleting a save file, as rewriting an existing file
+*** doesn't necessarily change the directory modification time.
+**/
+void InvalidateSaveFileCatalog();
+
+/** \brief Returns the cataloged information about a save slot file, without querying the file system.
+*** The catalog is scanned first if it never was or if it has been invalidated.
+**/
+const SaveFileInfo& GetSaveFileInfo(uint32_t slot_id, bool autosave = false);
+//@}
+
 } // namespace vt_utils
 
 #endif // __UTILS_FILES_HEADER__
@@ -194,15 +194,19 @@ extern "C" {
 // Common Defines and Typedefs
 //
 
+#include "utils/logger.h"
+
 /** \name Print Message Helper Macros
 *** These macros assist programmers with writing debug, warning, or error messages that are to be printed to
 *** a user's terminal. They are formatted as follows: `MSGTYPE:FILE:FUNCTION:LINE: `. To use the macro, all
 *** that is needed is to add `<< "print message" << std::endl;` after the macro name.
+*** The whole statement makes a single message, written asynchronously by the log writer thread
+*** and rate limited per call site. See utils/logger.h.
 **/
 //@{
-#define PRINT_DEBUG std::cout << "DEBUG:" << __FILE__ << ":" << __FUNCTION__ << ":" << __LINE__ << ": " << std::endl
-#define PRINT_WARNING std::cout << "WARNING:" << __FILE__ << ":" << __FUNCTION__ << ":" << __LINE__ << ": " << std::endl
-#define PRINT_ERROR std::cout << "ERROR:" << __FILE__ << ":" << __FUNCTION__ << ":" << __LINE__ << ": " << std::endl
+#define PRINT_DEBUG vt_utils::LogStream(vt_utils::LOG_DEBUG, nullptr, __FILE__, __FUNCTION__, __LINE__)
+#define PRINT_WARNING vt_utils::LogStream(vt_utils::LOG_WARNING, nullptr, __FILE__, __FUNCTION__, __LINE__)
+#define PRINT_ERROR vt_utils::LogStream(vt_utils::LOG_ERROR, nullptr, __FILE__, __FUNCTION__, __LINE__)
 //@}
 
 /** \name Print Message Helper Macros With Conditional
@@ -210,12 +214,12 @@ extern "C" {
 *** These macros perform the exact same function as the previous set of print message macros, but these include a conditional
 *** parameter. If the parameter is true the message will be printed and if it is false, no message will be printed. Note that
 *** the if statement is not enclosed in brackets, so the programmer is not required to add a terminating bracket after they
-*** append their print message.
+*** append their print message. The parameter name is used as the message category.
 *** \note There is no error conditional macro because detected errors should always be printed when they are discovered
 **/
 //@{
-#define IF_PRINT_DEBUG(var) if (var) std::cout << "DEBUG:" << __FILE__ << ":" << __FUNCTION__ << ":" << __LINE__ << ": " << std::endl
-#define IF_PRINT_WARNING(var) if (var) std::cout << "WARNING:" << __FILE__ << ":" << __FUNCTION__ << ":" << __LINE__ << ": " << std::endl
+#define IF_PRINT_DEBUG(var) if (var) vt_utils::LogStream(vt_utils::LOG_DEBUG, #var, __FILE__, __FUNCTION__, __LINE__)
+#define IF_PRINT_WARNING(var) if (var) vt_utils::LogStream(vt_utils::LOG_WARNING, #var, __FILE__, __FUNCTION__, __LINE__)
 //@}
 
 //! \brief Different App full, shortnames, and directories